@@ -0,0 +1,227 @@
+/****************************************************************************
+ * bench.c
+ * openacousticdevices.info
+ * October 2026
+ *****************************************************************************/
+
+#include <time.h>
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "detector.h"
+#include "nnmodel.h"
+#include "modelfile.h"
+
+/* Benchmark constants */
+
+#define DEFAULT_NUMBER_OF_FRAMES                100000
+#define NUMBER_OF_TEST_FRAMES                   64
+
+#define NANOSECONDS_IN_SECOND                   1000000000ULL
+
+/* Stages timed by the benchmark */
+
+typedef enum {WINDOW, FFT, MAGNITUDE, FILTERBANK, LOG10, DCT, DELTAS, NEURAL_NETWORK, NEURAL_NETWORK_BATCH, FULL_FRAME, NUMBER_OF_STAGES} stage_t;
+
+static const char *stageNames[NUMBER_OF_STAGES] = {"window", "arm_rfft_fast_f32", "arm_cmplx_mag_f32", "filterbank", "log10", "DCTII", "deltas", "neuralNetwork", "neuralNetworkBatch", "full frame"};
+
+/* Input frames and intermediate results */
+
+static int16_t frames[NUMBER_OF_TEST_FRAMES][NUMBER_OF_SAMPLES_IN_FRAME];
+
+static frontEnd_t windowed[NUMBER_OF_TEST_FRAMES][NUMBER_OF_SAMPLES_IN_FRAME];
+
+static frontEnd_t cplxFFT[NUMBER_OF_TEST_FRAMES][NUMBER_OF_FFT_OUTPUTS];
+
+static frontEnd_t spectrum[NUMBER_OF_TEST_FRAMES][NUMBER_OF_BINS_IN_FRAME];
+
+static float32_t energies[NUMBER_OF_TEST_FRAMES][NBANKS - 1];
+
+static float32_t logEnergies[NUMBER_OF_TEST_FRAMES][NBANKS - 1];
+
+static detectorArena_t detectorArena;
+
+static neuralNetworkBatch_t batch;
+
+static float32_t batchFeatures[NUMBER_OF_FEATURES * NN_MAXIMUM_BATCH_SIZE];
+
+static nnModel_t model;
+
+static volatile float32_t sink;
+
+/* Monotonic clock */
+
+static uint64_t getNanoseconds(void) {
+
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return (uint64_t)ts.tv_sec * NANOSECONDS_IN_SECOND + (uint64_t)ts.tv_nsec;
+
+}
+
+/* Synthetic input: noise with a frequency sweep through the 2-5 kHz call band */
+
+static void generateFrames(void) {
+
+    uint32_t seed = 0x12345678;
+
+    float phase = 0.0f;
+
+    for (uint32_t i = 0; i < NUMBER_OF_TEST_FRAMES; i += 1) {
+
+        float frequency = 2000.0f + 3000.0f * i / NUMBER_OF_TEST_FRAMES;
+
+        for (uint32_t j = 0; j < NUMBER_OF_SAMPLES_IN_FRAME; j += 1) {
+
+            seed = seed * 1664525 + 1013904223;
+
+            float noise = (float)(int32_t)(seed >> 16 & 0xFFFF) - 32768.0f;
+
+            phase += 6.2831853f * frequency / 32000.0f;
+
+            if (phase > 6.2831853f) phase -= 6.2831853f;
+
+            frames[i][j] = (int16_t)(0.05f * noise + 8000.0f * arm_sin_f32(phase));
+
+        }
+
+    }
+
+}
+
+/* Run one stage over the requested number of frames */
+
+static uint64_t runStage(stage_t stage, uint32_t numberOfFrames) {
+
+    float32_t output[NUMBER_OF_SAMPLES_IN_BUFFERS_MFCC];
+
+    uint64_t start = getNanoseconds();
+
+    for (uint32_t n = 0; n < numberOfFrames; n += 1) {
+
+        uint32_t i = n % NUMBER_OF_TEST_FRAMES;
+
+        switch (stage) {
+
+        case WINDOW:
+            Detector_applyWindow(&detectorArena.featureExtractor, frames[i], windowed[i]);
+            break;
+
+        case FFT:
+            Detector_applyWindow(&detectorArena.featureExtractor, frames[i], windowed[i]);
+            Detector_FFT(&detectorArena.featureExtractor, windowed[i], cplxFFT[i]);
+            break;
+
+        case MAGNITUDE:
+            Detector_magnitude(cplxFFT[i], spectrum[i]);
+            break;
+
+        case FILTERBANK:
+            Detector_melFilterbank(&detectorArena.featureExtractor, spectrum[i], energies[i]);
+            break;
+
+        case LOG10:
+            Detector_logEnergies(energies[i], logEnergies[i]);
+            break;
+
+        case DCT:
+            Detector_DCTII(&detectorArena.featureExtractor, logEnergies[i], output);
+            break;
+
+        case DELTAS:
+            output[0] = *Detector_deltas(&detectorArena.mfccHistory);
+            break;
+
+        case NEURAL_NETWORK:
+            output[0] = Detector_neuralNetwork(&detectorArena.neuralNetwork, &model, detectorArena.mfccHistory.slots[0])[0];
+            break;
+
+        case NEURAL_NETWORK_BATCH:
+            if (n % NN_MAXIMUM_BATCH_SIZE == NN_MAXIMUM_BATCH_SIZE - 1) output[0] = Detector_neuralNetworkBatch(&batch, &detectorArena.neuralNetwork, &model, batchFeatures, NN_MAXIMUM_BATCH_SIZE)[0];
+            break;
+
+        case FULL_FRAME:
+            Detector_MFCC(&detectorArena.featureExtractor, frames[i], Detector_advanceHistory(&detectorArena.mfccHistory));
+            output[0] = Detector_neuralNetwork(&detectorArena.neuralNetwork, &model, Detector_deltas(&detectorArena.mfccHistory))[0];
+            break;
+
+        default:
+            break;
+
+        }
+
+        sink += output[0];
+
+    }
+
+    return getNanoseconds() - start;
+
+}
+
+int main(int argc, char **argv) {
+
+    uint32_t numberOfFrames = argc > 1 ? (uint32_t)strtoul(argv[1], NULL, 10) : DEFAULT_NUMBER_OF_FRAMES;
+
+    if (numberOfFrames == 0) numberOfFrames = DEFAULT_NUMBER_OF_FRAMES;
+
+    generateFrames();
+
+    Detector_resetArena(&detectorArena);
+
+    /* Time the built-in model unless a model file is given */
+
+    if (argc > 2) {
+
+        if (!ModelFile_read(argv[2], &model, NUMBER_OF_FEATURES)) return EXIT_FAILURE;
+
+    } else {
+
+        NNModel_loadDefault(&model);
+
+    }
+
+    /* Warm up every stage so the inputs of later stages hold real data */
+
+    for (uint32_t stage = 0; stage < NUMBER_OF_STAGES; stage += 1) {
+
+        runStage(stage, NUMBER_OF_TEST_FRAMES);
+
+        /* The batch takes the features in the history as its columns */
+
+        if (stage == DELTAS) {
+
+            for (uint32_t i = 0; i < NUMBER_OF_FEATURES * NN_MAXIMUM_BATCH_SIZE; i += 1) {
+                batchFeatures[i] = detectorArena.mfccHistory.slots[i % NUMBER_OF_BUFFERS_MFCC][i / NN_MAXIMUM_BATCH_SIZE];
+            }
+
+        }
+
+    }
+
+    printf("Detector benchmark: %u frames of %u samples, %s model\n\n", numberOfFrames, NUMBER_OF_SAMPLES_IN_FRAME, model.encoding == NN_INT8 ? "int8" : "float32");
+
+    printf("%-20s %12s %12s\n", "Stage", "Total (ms)", "Per frame (ns)");
+
+    uint64_t fftNanoseconds = 0;
+
+    for (uint32_t stage = 0; stage < NUMBER_OF_STAGES; stage += 1) {
+
+        uint64_t nanoseconds = runStage(stage, numberOfFrames);
+
+        /* The FFT stage re-applies the window because the FFT consumes its input */
+
+        if (stage == WINDOW) fftNanoseconds = nanoseconds;
+
+        if (stage == FFT) nanoseconds = nanoseconds > fftNanoseconds ? nanoseconds - fftNanoseconds : 0;
+
+        printf("%-20s %12.3f %12.1f\n", stageNames[stage], (double)nanoseconds / 1e6, (double)nanoseconds / numberOfFrames);
+
+    }
+
+    return 0;
+
+}
@@ -0,0 +1,511 @@
+/****************************************************************************
+ * arm_math.c
+ * openacousticdevices.info
+ * October 2026
+ *****************************************************************************/
+
+#include <math.h>
+#include <string.h>
+
+#include "arm_math.h"
+
+#define TWO_PI                              6.283185307179586476925
+
+#define Q31_FRACTIONAL_BITS                 31
+
+/* Matrix functions */
+
+void arm_mat_init_f32(arm_matrix_instance_f32 *S, uint16_t nRows, uint16_t nColumns, float32_t *pData) {
+
+    S->numRows = nRows;
+    S->numCols = nColumns;
+    S->pData = pData;
+
+}
+
+arm_status arm_mat_mult_f32(const arm_matrix_instance_f32 *pSrcA, const arm_matrix_instance_f32 *pSrcB, arm_matrix_instance_f32 *pDst) {
+
+    if (pSrcA->numCols != pSrcB->numRows || pSrcA->numRows != pDst->numRows || pSrcB->numCols != pDst->numCols) return ARM_MATH_SIZE_MISMATCH;
+
+    for (uint32_t i = 0; i < pSrcA->numRows; i += 1) {
+
+        for (uint32_t j = 0; j < pSrcB->numCols; j += 1) {
+
+            float32_t sum = 0.0f;
+
+            for (uint32_t k = 0; k < pSrcA->numCols; k += 1) {
+                sum += pSrcA->pData[i * pSrcA->numCols + k] * pSrcB->pData[k * pSrcB->numCols + j];
+            }
+
+            pDst->pData[i * pDst->numCols + j] = sum;
+
+        }
+
+    }
+
+    return ARM_MATH_SUCCESS;
+
+}
+
+arm_status arm_mat_add_f32(const arm_matrix_instance_f32 *pSrcA, const arm_matrix_instance_f32 *pSrcB, arm_matrix_instance_f32 *pDst) {
+
+    if (pSrcA->numRows != pSrcB->numRows || pSrcA->numCols != pSrcB->numCols || pSrcA->numRows != pDst->numRows || pSrcA->numCols != pDst->numCols) return ARM_MATH_SIZE_MISMATCH;
+
+    uint32_t numSamples = (uint32_t)pSrcA->numRows * pSrcA->numCols;
+
+    for (uint32_t i = 0; i < numSamples; i += 1) {
+        pDst->pData[i] = pSrcA->pData[i] + pSrcB->pData[i];
+    }
+
+    return ARM_MATH_SUCCESS;
+
+}
+
+arm_status arm_mat_scale_f32(const arm_matrix_instance_f32 *pSrc, float32_t scale, arm_matrix_instance_f32 *pDst) {
+
+    if (pSrc->numRows != pDst->numRows || pSrc->numCols != pDst->numCols) return ARM_MATH_SIZE_MISMATCH;
+
+    uint32_t numSamples = (uint32_t)pSrc->numRows * pSrc->numCols;
+
+    for (uint32_t i = 0; i < numSamples; i += 1) {
+        pDst->pData[i] = pSrc->pData[i] * scale;
+    }
+
+    return ARM_MATH_SUCCESS;
+
+}
+
+/* As in CMSIS-DSP, four rows are accumulated at a time so each vector element is loaded once per row block */
+
+void arm_mat_vec_mult_f32(const arm_matrix_instance_f32 *pSrcMat, const float32_t *pVec, float32_t *pDst) {
+
+    uint32_t numRows = pSrcMat->numRows;
+
+    uint32_t numCols = pSrcMat->numCols;
+
+    uint32_t i = 0;
+
+    for (; i + 4 <= numRows; i += 4) {
+
+        const float32_t *row0 = pSrcMat->pData + i * numCols;
+        const float32_t *row1 = row0 + numCols;
+        const float32_t *row2 = row1 + numCols;
+        const float32_t *row3 = row2 + numCols;
+
+        float32_t sum0 = 0.0f, sum1 = 0.0f, sum2 = 0.0f, sum3 = 0.0f;
+
+        for (uint32_t j = 0; j < numCols; j += 1) {
+
+            float32_t x = pVec[j];
+
+            sum0 += row0[j] * x;
+            sum1 += row1[j] * x;
+            sum2 += row2[j] * x;
+            sum3 += row3[j] * x;
+
+        }
+
+        pDst[i] = sum0;
+        pDst[i + 1] = sum1;
+        pDst[i + 2] = sum2;
+        pDst[i + 3] = sum3;
+
+    }
+
+    for (; i < numRows; i += 1) {
+
+        float32_t sum = 0.0f;
+
+        for (uint32_t j = 0; j < numCols; j += 1) {
+            sum += pSrcMat->pData[i * numCols + j] * pVec[j];
+        }
+
+        pDst[i] = sum;
+
+    }
+
+}
+
+/* Transform functions */
+
+arm_status arm_rfft_fast_init_f32(arm_rfft_fast_instance_f32 *S, uint16_t fftLen) {
+
+    if (fftLen < 32 || fftLen > ARM_HOST_MAXIMUM_FFT_LENGTH || (fftLen & (fftLen - 1))) return ARM_MATH_ARGUMENT_ERROR;
+
+    S->fftLenRFFT = fftLen;
+
+    S->fftLenCFFT = fftLen / 2;
+
+    /* Twiddles of the half-length complex FFT */
+
+    for (uint32_t k = 0; k < S->fftLenCFFT / 2; k += 1) {
+
+        double angle = TWO_PI * k / S->fftLenCFFT;
+
+        S->twiddleCFFT[2 * k] = (float32_t)cos(angle);
+        S->twiddleCFFT[2 * k + 1] = (float32_t)-sin(angle);
+
+    }
+
+    /* Twiddles of the split step that recovers the real spectrum */
+
+    for (uint32_t k = 0; k < S->fftLenCFFT; k += 1) {
+
+        double angle = TWO_PI * k / S->fftLenRFFT;
+
+        S->twiddleRFFT[2 * k] = (float32_t)cos(angle);
+        S->twiddleRFFT[2 * k + 1] = (float32_t)-sin(angle);
+
+    }
+
+    return ARM_MATH_SUCCESS;
+
+}
+
+static void cfft_f32(const arm_rfft_fast_instance_f32 *S, float32_t *p) {
+
+    uint32_t length = S->fftLenCFFT;
+
+    /* Bit reversal */
+
+    for (uint32_t i = 1, j = 0; i < length; i += 1) {
+
+        uint32_t bit = length >> 1;
+
+        while (j & bit) {
+            j ^= bit;
+            bit >>= 1;
+        }
+
+        j |= bit;
+
+        if (i < j) {
+
+            float32_t re = p[2 * i];
+            float32_t im = p[2 * i + 1];
+
+            p[2 * i] = p[2 * j];
+            p[2 * i + 1] = p[2 * j + 1];
+
+            p[2 * j] = re;
+            p[2 * j + 1] = im;
+
+        }
+
+    }
+
+    /* Radix-2 decimation in time butterflies */
+
+    for (uint32_t size = 2; size <= length; size <<= 1) {
+
+        uint32_t half = size >> 1;
+
+        uint32_t step = length / size;
+
+        for (uint32_t i = 0; i < length; i += size) {
+
+            for (uint32_t j = 0; j < half; j += 1) {
+
+                float32_t wr = S->twiddleCFFT[2 * j * step];
+                float32_t wi = S->twiddleCFFT[2 * j * step + 1];
+
+                float32_t *a = p + 2 * (i + j);
+                float32_t *b = p + 2 * (i + j + half);
+
+                float32_t tr = wr * b[0] - wi * b[1];
+                float32_t ti = wr * b[1] + wi * b[0];
+
+                b[0] = a[0] - tr;
+                b[1] = a[1] - ti;
+
+                a[0] += tr;
+                a[1] += ti;
+
+            }
+
+        }
+
+    }
+
+}
+
+/* Forward transform only. As in CMSIS-DSP the input buffer is used as scratch and the output is packed as
+ * {X[0], X[N/2], Re X[1], Im X[1], ..., Re X[N/2-1], Im X[N/2-1]} */
+
+void arm_rfft_fast_f32(const arm_rfft_fast_instance_f32 *S, float32_t *p, float32_t *pOut, uint8_t ifftFlag) {
+
+    uint32_t length = S->fftLenCFFT;
+
+    (void)ifftFlag;
+
+    cfft_f32(S, p);
+
+    pOut[0] = p[0] + p[1];
+    pOut[1] = p[0] - p[1];
+
+    for (uint32_t k = 1; k < length; k += 1) {
+
+        float32_t zr = p[2 * k];
+        float32_t zi = p[2 * k + 1];
+
+        float32_t cr = p[2 * (length - k)];
+        float32_t ci = -p[2 * (length - k) + 1];
+
+        float32_t er = 0.5f * (zr + cr);
+        float32_t ei = 0.5f * (zi + ci);
+
+        float32_t odr = 0.5f * (zi - ci);
+        float32_t odi = -0.5f * (zr - cr);
+
+        float32_t wr = S->twiddleRFFT[2 * k];
+        float32_t wi = S->twiddleRFFT[2 * k + 1];
+
+        pOut[2 * k] = er + wr * odr - wi * odi;
+        pOut[2 * k + 1] = ei + wr * odi + wi * odr;
+
+    }
+
+}
+
+/* Fixed-point real FFT. Samples are held in 64 bits with Q31 twiddles. Each butterfly stage and the final split
+ * halve the values, which gives the 1/fftLenReal output scaling of CMSIS-DSP, and the output is
+ * {Re X[0], Im X[0], ..., Re X[N/2], Im X[N/2]} */
+
+static void initialiseFixedTwiddles(uint32_t fftLenReal, q31_t *twiddle) {
+
+    double one = (double)((int64_t)1 << Q31_FRACTIONAL_BITS);
+
+    int64_t maximum = ((int64_t)1 << Q31_FRACTIONAL_BITS) - 1;
+
+    for (uint32_t k = 0; k < fftLenReal / 2; k += 1) {
+
+        double angle = TWO_PI * k / fftLenReal;
+
+        int64_t re = (int64_t)llround(cos(angle) * one);
+        int64_t im = (int64_t)llround(-sin(angle) * one);
+
+        twiddle[2 * k] = (q31_t)(re > maximum ? maximum : re);
+        twiddle[2 * k + 1] = (q31_t)(im > maximum ? maximum : im);
+
+    }
+
+}
+
+static q31_t saturate(int64_t x) {
+
+    return x > INT32_MAX ? INT32_MAX : x < INT32_MIN ? INT32_MIN : (q31_t)x;
+
+}
+
+static void rfft_fixed(uint32_t fftLenReal, const q31_t *twiddle, int64_t *p) {
+
+    uint32_t length = fftLenReal / 2;
+
+    /* Bit reversal of the half-length complex sequence */
+
+    for (uint32_t i = 1, j = 0; i < length; i += 1) {
+
+        uint32_t bit = length >> 1;
+
+        while (j & bit) {
+            j ^= bit;
+            bit >>= 1;
+        }
+
+        j |= bit;
+
+        if (i < j) {
+
+            int64_t re = p[2 * i];
+            int64_t im = p[2 * i + 1];
+
+            p[2 * i] = p[2 * j];
+            p[2 * i + 1] = p[2 * j + 1];
+
+            p[2 * j] = re;
+            p[2 * j + 1] = im;
+
+        }
+
+    }
+
+    /* Scaled radix-2 butterflies, using every other twiddle of the real transform */
+
+    for (uint32_t size = 2; size <= length; size <<= 1) {
+
+        uint32_t half = size >> 1;
+
+        uint32_t step = length / size;
+
+        for (uint32_t i = 0; i < length; i += size) {
+
+            for (uint32_t j = 0; j < half; j += 1) {
+
+                int64_t wr = twiddle[4 * j * step];
+                int64_t wi = twiddle[4 * j * step + 1];
+
+                int64_t *a = p + 2 * (i + j);
+                int64_t *b = p + 2 * (i + j + half);
+
+                int64_t tr = (wr * b[0] - wi * b[1]) >> Q31_FRACTIONAL_BITS;
+                int64_t ti = (wr * b[1] + wi * b[0]) >> Q31_FRACTIONAL_BITS;
+
+                b[0] = (a[0] - tr) >> 1;
+                b[1] = (a[1] - ti) >> 1;
+
+                a[0] = (a[0] + tr) >> 1;
+                a[1] = (a[1] + ti) >> 1;
+
+            }
+
+        }
+
+    }
+
+}
+
+static void splitFixed(uint32_t fftLenReal, const q31_t *twiddle, const int64_t *p, int64_t *pOut) {
+
+    uint32_t length = fftLenReal / 2;
+
+    pOut[0] = (p[0] + p[1]) >> 1;
+    pOut[1] = 0;
+
+    pOut[2 * length] = (p[0] - p[1]) >> 1;
+    pOut[2 * length + 1] = 0;
+
+    for (uint32_t k = 1; k < length; k += 1) {
+
+        int64_t zr = p[2 * k];
+        int64_t zi = p[2 * k + 1];
+
+        int64_t cr = p[2 * (length - k)];
+        int64_t ci = -p[2 * (length - k) + 1];
+
+        int64_t er = zr + cr;
+        int64_t ei = zi + ci;
+
+        int64_t odr = zi - ci;
+        int64_t odi = cr - zr;
+
+        int64_t wr = twiddle[2 * k];
+        int64_t wi = twiddle[2 * k + 1];
+
+        pOut[2 * k] = (er + ((wr * odr - wi * odi) >> Q31_FRACTIONAL_BITS)) >> 2;
+        pOut[2 * k + 1] = (ei + ((wr * odi + wi * odr) >> Q31_FRACTIONAL_BITS)) >> 2;
+
+    }
+
+}
+
+arm_status arm_rfft_init_q31(arm_rfft_instance_q31 *S, uint32_t fftLenReal, uint32_t ifftFlagR, uint32_t bitReverseFlag) {
+
+    if (fftLenReal < 32 || fftLenReal > ARM_HOST_MAXIMUM_FFT_LENGTH || (fftLenReal & (fftLenReal - 1))) return ARM_MATH_ARGUMENT_ERROR;
+
+    S->fftLenReal = fftLenReal;
+    S->ifftFlagR = ifftFlagR;
+    S->bitReverseFlagR = bitReverseFlag;
+
+    initialiseFixedTwiddles(fftLenReal, S->twiddle);
+
+    return ARM_MATH_SUCCESS;
+
+}
+
+/* Forward transform only. pDst must hold fftLenReal + 2 values */
+
+void arm_rfft_q31(const arm_rfft_instance_q31 *S, q31_t *pSrc, q31_t *pDst) {
+
+    int64_t p[ARM_HOST_MAXIMUM_FFT_LENGTH] = {0};
+    int64_t out[ARM_HOST_MAXIMUM_FFT_LENGTH + 2];
+
+    for (uint32_t i = 0; i < S->fftLenReal; i += 1) p[i] = pSrc[i];
+
+    rfft_fixed(S->fftLenReal, S->twiddle, p);
+
+    splitFixed(S->fftLenReal, S->twiddle, p, out);
+
+    for (uint32_t i = 0; i < S->fftLenReal + 2; i += 1) pDst[i] = saturate(out[i]);
+
+}
+
+/* Complex math functions */
+
+/* The float dot product keeps four partial sums, as the unrolled CMSIS-DSP loop does */
+
+void arm_dot_prod_f32(const float32_t *pSrcA, const float32_t *pSrcB, uint32_t blockSize, float32_t *result) {
+
+    float32_t sum0 = 0.0f, sum1 = 0.0f, sum2 = 0.0f, sum3 = 0.0f;
+
+    uint32_t i = 0;
+
+    for (; i + 4 <= blockSize; i += 4) {
+        sum0 += pSrcA[i] * pSrcB[i];
+        sum1 += pSrcA[i + 1] * pSrcB[i + 1];
+        sum2 += pSrcA[i + 2] * pSrcB[i + 2];
+        sum3 += pSrcA[i + 3] * pSrcB[i + 3];
+    }
+
+    for (; i < blockSize; i += 1) {
+        sum0 += pSrcA[i] * pSrcB[i];
+    }
+
+    *result = (sum0 + sum1) + (sum2 + sum3);
+
+}
+
+void arm_dot_prod_q7(const q7_t *pSrcA, const q7_t *pSrcB, uint32_t blockSize, q31_t *result) {
+
+    q31_t sum = 0;
+
+    for (uint32_t i = 0; i < blockSize; i += 1) {
+        sum += (q15_t)pSrcA[i] * pSrcB[i];
+    }
+
+    *result = sum;
+
+}
+
+void arm_dot_prod_q31(const q31_t *pSrcA, const q31_t *pSrcB, uint32_t blockSize, q63_t *result) {
+
+    q63_t sum = 0;
+
+    for (uint32_t i = 0; i < blockSize; i += 1) {
+        sum += ((q63_t)pSrcA[i] * pSrcB[i]) >> 14;
+    }
+
+    *result = sum;
+
+}
+
+void arm_cmplx_mag_f32(const float32_t *pSrc, float32_t *pDst, uint32_t numSamples) {
+
+    for (uint32_t i = 0; i < numSamples; i += 1) {
+        pDst[i] = sqrtf(pSrc[2 * i] * pSrc[2 * i] + pSrc[2 * i + 1] * pSrc[2 * i + 1]);
+    }
+
+}
+
+/* The fixed-point magnitudes are returned in 2.30 format, i.e. halved */
+
+void arm_cmplx_mag_q31(const q31_t *pSrc, q31_t *pDst, uint32_t numSamples) {
+
+    for (uint32_t i = 0; i < numSamples; i += 1) {
+        pDst[i] = (q31_t)(sqrt((double)pSrc[2 * i] * pSrc[2 * i] + (double)pSrc[2 * i + 1] * pSrc[2 * i + 1]) / 2.0);
+    }
+
+}
+
+/* Fast math functions */
+
+float32_t arm_cos_f32(float32_t x) {
+
+    return cosf(x);
+
+}
+
+float32_t arm_sin_f32(float32_t x) {
+
+    return sinf(x);
+
+}
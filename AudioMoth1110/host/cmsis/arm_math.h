@@ -0,0 +1,107 @@
+/****************************************************************************
+ * arm_math.h
+ * openacousticdevices.info
+ * October 2026
+ *****************************************************************************/
+
+/* Portable stand-in for the subset of CMSIS-DSP used by the detector. It
+ * mirrors the CMSIS-DSP types, packing conventions and function signatures
+ * so that the firmware sources build unchanged with a host compiler. */
+
+#ifndef __ARM_MATH_H
+#define __ARM_MATH_H
+
+#include <stdint.h>
+
+typedef float float32_t;
+
+typedef double float64_t;
+
+typedef int8_t q7_t;
+
+typedef int16_t q15_t;
+
+typedef int32_t q31_t;
+
+typedef int64_t q63_t;
+
+typedef enum {
+    ARM_MATH_SUCCESS = 0,
+    ARM_MATH_ARGUMENT_ERROR = -1,
+    ARM_MATH_LENGTH_ERROR = -2,
+    ARM_MATH_SIZE_MISMATCH = -3,
+    ARM_MATH_NANINF = -4,
+    ARM_MATH_SINGULAR = -5,
+    ARM_MATH_TEST_FAILURE = -6
+} arm_status;
+
+#define PI                                  3.14159265358979f
+
+/* Matrix functions */
+
+typedef struct {
+    uint16_t numRows;
+    uint16_t numCols;
+    float32_t *pData;
+} arm_matrix_instance_f32;
+
+void arm_mat_init_f32(arm_matrix_instance_f32 *S, uint16_t nRows, uint16_t nColumns, float32_t *pData);
+
+arm_status arm_mat_mult_f32(const arm_matrix_instance_f32 *pSrcA, const arm_matrix_instance_f32 *pSrcB, arm_matrix_instance_f32 *pDst);
+
+arm_status arm_mat_add_f32(const arm_matrix_instance_f32 *pSrcA, const arm_matrix_instance_f32 *pSrcB, arm_matrix_instance_f32 *pDst);
+
+arm_status arm_mat_scale_f32(const arm_matrix_instance_f32 *pSrc, float32_t scale, arm_matrix_instance_f32 *pDst);
+
+void arm_mat_vec_mult_f32(const arm_matrix_instance_f32 *pSrcMat, const float32_t *pVec, float32_t *pDst);
+
+/* Transform functions */
+
+#define ARM_HOST_MAXIMUM_FFT_LENGTH         4096
+
+typedef struct {
+    uint16_t fftLenRFFT;
+    uint16_t fftLenCFFT;
+    float32_t twiddleCFFT[ARM_HOST_MAXIMUM_FFT_LENGTH / 2];
+    float32_t twiddleRFFT[ARM_HOST_MAXIMUM_FFT_LENGTH];
+} arm_rfft_fast_instance_f32;
+
+arm_status arm_rfft_fast_init_f32(arm_rfft_fast_instance_f32 *S, uint16_t fftLen);
+
+void arm_rfft_fast_f32(const arm_rfft_fast_instance_f32 *S, float32_t *p, float32_t *pOut, uint8_t ifftFlag);
+
+/* The fixed-point transform scales each radix-2 stage by 1/2, so as in CMSIS-DSP the output is the DFT divided by fftLenReal */
+
+typedef struct {
+    uint32_t fftLenReal;
+    uint8_t ifftFlagR;
+    uint8_t bitReverseFlagR;
+    q31_t twiddle[ARM_HOST_MAXIMUM_FFT_LENGTH];
+} arm_rfft_instance_q31;
+
+arm_status arm_rfft_init_q31(arm_rfft_instance_q31 *S, uint32_t fftLenReal, uint32_t ifftFlagR, uint32_t bitReverseFlag);
+
+void arm_rfft_q31(const arm_rfft_instance_q31 *S, q31_t *pSrc, q31_t *pDst);
+
+/* Basic math functions. The Q7 dot product returns the exact sum in 18.14 format and the Q31 dot product
+ * drops 14 bits of each product, returning the sum in 16.48 format */
+
+void arm_dot_prod_f32(const float32_t *pSrcA, const float32_t *pSrcB, uint32_t blockSize, float32_t *result);
+
+void arm_dot_prod_q7(const q7_t *pSrcA, const q7_t *pSrcB, uint32_t blockSize, q31_t *result);
+
+void arm_dot_prod_q31(const q31_t *pSrcA, const q31_t *pSrcB, uint32_t blockSize, q63_t *result);
+
+/* Complex math functions */
+
+void arm_cmplx_mag_f32(const float32_t *pSrc, float32_t *pDst, uint32_t numSamples);
+
+void arm_cmplx_mag_q31(const q31_t *pSrc, q31_t *pDst, uint32_t numSamples);
+
+/* Fast math functions */
+
+float32_t arm_cos_f32(float32_t x);
+
+float32_t arm_sin_f32(float32_t x);
+
+#endif /* __ARM_MATH_H */
@@ -0,0 +1,125 @@
+/****************************************************************************
+ * compare.c
+ * openacousticdevices.info
+ * October 2026
+ *****************************************************************************/
+
+/* Compares two score files written by the scores tool and reports the score
+ * deviation and how many frames change their detection decision. */
+
+#include <math.h>
+#include <stdio.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+#define DEFAULT_THRESHOLD                       0.5
+
+int main(int argc, char **argv) {
+
+    double threshold = DEFAULT_THRESHOLD;
+
+    double maximumAllowedDeviation = -1.0;
+
+    int option;
+
+    while ((option = getopt(argc, argv, "t:m:")) != -1) {
+
+        switch (option) {
+        case 't': threshold = atof(optarg); break;
+        case 'm': maximumAllowedDeviation = atof(optarg); break;
+        default: optind = argc + 1; break;
+        }
+
+    }
+
+    if (optind + 2 != argc) {
+
+        fprintf(stderr, "Usage: %s [-t threshold] [-m maximum deviation] reference.txt candidate.txt\n", argv[0]);
+
+        return 1;
+
+    }
+
+    FILE *reference = fopen(argv[optind], "r");
+
+    FILE *candidate = fopen(argv[optind + 1], "r");
+
+    if (reference == NULL || candidate == NULL) {
+
+        fprintf(stderr, "Could not open the score files\n");
+
+        return 1;
+
+    }
+
+    uint32_t numberOfFrames = 0;
+
+    uint32_t numberOfFlips = 0;
+
+    uint32_t referenceDetections = 0;
+
+    uint32_t candidateDetections = 0;
+
+    double maximumDeviation = 0.0;
+
+    double totalDeviation = 0.0;
+
+    double maximumDeviationTime = 0.0;
+
+    double referenceTime, referenceScore, candidateTime, candidateScore;
+
+    while (fscanf(reference, "%lf %lf", &referenceTime, &referenceScore) == 2 && fscanf(candidate, "%lf %lf", &candidateTime, &candidateScore) == 2) {
+
+        double deviation = fabs(candidateScore - referenceScore);
+
+        if (deviation != deviation) deviation = INFINITY;
+
+        if (deviation > maximumDeviation) {
+
+            maximumDeviation = deviation;
+
+            maximumDeviationTime = referenceTime;
+
+        }
+
+        totalDeviation += deviation;
+
+        bool referenceDetection = referenceScore > threshold;
+
+        bool candidateDetection = candidateScore > threshold;
+
+        referenceDetections += referenceDetection;
+
+        candidateDetections += candidateDetection;
+
+        numberOfFlips += referenceDetection != candidateDetection;
+
+        numberOfFrames += 1;
+
+    }
+
+    fclose(reference);
+
+    fclose(candidate);
+
+    printf("Frames compared         : %u\n", numberOfFrames);
+    printf("Maximum score deviation : %.3g (at %.3f s)\n", maximumDeviation, maximumDeviationTime);
+    printf("Mean score deviation    : %.3g\n", numberOfFrames > 0 ? totalDeviation / numberOfFrames : 0.0);
+    printf("Detections              : %u reference, %u candidate (threshold %.2f)\n", referenceDetections, candidateDetections, threshold);
+    printf("Detection flips         : %u (%.3f%% of frames)\n", numberOfFlips, numberOfFrames > 0 ? 100.0 * numberOfFlips / numberOfFrames : 0.0);
+
+    if (numberOfFrames == 0) return 1;
+
+    if (maximumAllowedDeviation >= 0.0 && maximumDeviation > maximumAllowedDeviation) {
+
+        printf("FAILED: deviation exceeds %.3g\n", maximumAllowedDeviation);
+
+        return 1;
+
+    }
+
+    return 0;
+
+}
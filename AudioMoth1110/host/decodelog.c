@@ -0,0 +1,294 @@
+/****************************************************************************
+ * decodelog.c
+ * openacousticdevices.info
+ * October 2026
+ *****************************************************************************/
+
+/* Decodes the binary detection logs (calls.bin) written with NN_BINARY_LOG.
+ * By default the records are printed as the lines the firmware would have
+ * written to calls.txt, in the local time of the device. With -c they are
+ * exported as CSV, one row per record in UTC with the timezone offset, the
+ * serial number and the model CRC of its recording, and with -s only the
+ * header of each recording and its number of records are printed. Version 1
+ * logs have no timezone offset and are timed in local time, which the CSV
+ * gives without the UTC suffix and with an empty offset. */
+
+#include <time.h>
+#include <stdio.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "detectionlog.h"
+
+#define OUTPUT_BUFFER_SIZE                      65536
+
+#define HUNDREDTHS_IN_SECOND                    100
+#define MINUTES_IN_HOUR                         60
+
+/* First version of the binary log timed in UTC */
+
+#define UTC_VERSION                             2
+
+#define MIN(a, b)                               ((a) < (b) ? (a) : (b))
+
+typedef enum {OUTPUT_TEXT, OUTPUT_CSV, OUTPUT_SUMMARY} outputFormat_t;
+
+static detectionLog_t detectionLog;
+
+static char outputBuffer[OUTPUT_BUFFER_SIZE];
+
+/* Read a whole file into memory */
+
+static uint8_t* readFile(const char *filename, uint32_t *size) {
+
+    FILE *file = fopen(filename, "rb");
+
+    if (file == NULL) return NULL;
+
+    fseek(file, 0, SEEK_END);
+
+    long length = ftell(file);
+
+    fseek(file, 0, SEEK_SET);
+
+    uint8_t *data = malloc(length > 0 ? length : 1);
+
+    if (data && fread(data, 1, length, file) != (size_t)length) {
+
+        free(data);
+
+        data = NULL;
+
+    }
+
+    fclose(file);
+
+    *size = length;
+
+    return data;
+
+}
+
+/* Format the records gathered in the detection log as calls.txt lines */
+
+static void flushText(void) {
+
+    uint32_t length;
+
+    while ((length = DetectionLog_format(&detectionLog, outputBuffer, OUTPUT_BUFFER_SIZE)) > 0) fwrite(outputBuffer, 1, length, stdout);
+
+    detectionLog.first = 0;
+
+}
+
+static void printHeader(const char *filename, const detectionLogHeader_t *header, uint32_t numberOfRecords) {
+
+    char startTime[32];
+
+    time_t rawTime = header->startTime;
+
+    strftime(startTime, sizeof(startTime), "%Y/%m/%d %H:%M:%S", gmtime(&rawTime));
+
+    uint32_t offset = abs(header->timezoneMinutes);
+
+    if (header->version >= UTC_VERSION) {
+
+        sprintf(startTime + strlen(startTime), " UTC%c%02u:%02u", header->timezoneMinutes < 0 ? '-' : '+', offset / MINUTES_IN_HOUR, offset % MINUTES_IN_HOUR);
+
+    } else {
+
+        strcat(startTime, " local");
+
+    }
+
+    printf("%s: %s, serial %08X%08X, %u Hz, model %08X", filename, startTime, *(uint32_t*)(header->serialNumber + 4), *(uint32_t*)header->serialNumber, header->sampleRate, header->modelCRC);
+
+    if (header->flags & DETECTION_LOG_FLAG_CASCADE) printf(", confirmer %08X", header->confirmerCRC);
+
+    printf(", thresholds");
+
+    for (uint32_t i = 0; i < MIN(header->numberOfClasses, DETECTION_LOG_MAXIMUM_NUMBER_OF_CLASSES); i += 1) printf(" %.3f", header->thresholds[i]);
+
+    if (header->flags & DETECTION_LOG_FLAG_EVENTS) printf(", events (gap %u ms, minimum %u ms)", header->maximumGap, header->minimumDuration);
+
+    printf(", %u %s\n", numberOfRecords, header->flags & DETECTION_LOG_FLAG_EVENTS ? "events" : "detections");
+
+}
+
+static void printCSV(const detectionLogHeader_t *header, const detection_t *record) {
+
+    char time[32];
+
+    bool utc = header->version >= UTC_VERSION;
+
+    time_t rawTime = record->time;
+
+    struct tm timeStruct;
+
+    gmtime_r(&rawTime, &timeStruct);
+
+    strftime(time, sizeof(time), "%Y-%m-%dT%H:%M:%S", &timeStruct);
+
+    char timezone[8] = "";
+
+    if (utc) sprintf(timezone, "%d", header->timezoneMinutes);
+
+    printf("%08X%08X,%08X,%08X,%s.%03u%s,%s,%u,%u.%02u,%u,%.4f,%.4f\n", *(uint32_t*)(header->serialNumber + 4), *(uint32_t*)header->serialNumber, header->modelCRC, header->confirmerCRC, time, record->milliseconds, utc ? "Z" : "", timezone, record->detectedClass, record->duration / HUNDREDTHS_IN_SECOND, record->duration % HUNDREDTHS_IN_SECOND, record->numberOfFrames, (double)record->peakScore / DETECTION_LOG_SCORE_ONE, (double)record->meanScore / DETECTION_LOG_SCORE_ONE);
+
+}
+
+/* Check whether the bytes at a record boundary are the header of a recording. The header has no count of its
+ * records, since they are appended over several writes, so the headers are found by their magic number. A record
+ * whose time equals the magic number is told apart by the other fields: its milliseconds would have to be a known
+ * version, its duration a header size, its number of frames the record size and its peak score, below 4 / 65535,
+ * only known flags. The header may be truncated, which the caller checks with its size */
+
+static bool isHeader(const uint8_t *data, uint32_t remaining) {
+
+    detectionLogHeader_t header;
+
+    if (remaining < offsetof(detectionLogHeader_t, serialNumber)) return false;
+
+    memcpy(&header, data, offsetof(detectionLogHeader_t, serialNumber));
+
+    if (header.magic != DETECTION_LOG_MAGIC || header.version == 0 || header.version > DETECTION_LOG_VERSION) return false;
+
+    if (header.headerSize < offsetof(detectionLogHeader_t, thresholds) || header.recordSize != sizeof(detection_t)) return false;
+
+    return (header.flags & ~(DETECTION_LOG_FLAG_EVENTS | DETECTION_LOG_FLAG_CASCADE)) == 0;
+
+}
+
+/* Decode one binary log, returning false if it is not a detection log or is truncated */
+
+static bool decodeFile(const char *filename, outputFormat_t format) {
+
+    uint32_t size;
+
+    uint8_t *data = readFile(filename, &size);
+
+    if (data == NULL) {
+
+        fprintf(stderr, "Could not read %s\n", filename);
+
+        return false;
+
+    }
+
+    detectionLogHeader_t header;
+
+    bool headerFound = false;
+
+    uint32_t numberOfRecords = 0;
+
+    uint32_t position = 0;
+
+    while (position < size) {
+
+        if (isHeader(data + position, size - position)) {
+
+            uint16_t headerSize;
+
+            memcpy(&headerSize, data + position + offsetof(detectionLogHeader_t, headerSize), sizeof(uint16_t));
+
+            if (size - position < headerSize) break;
+
+            if (format == OUTPUT_TEXT) flushText();
+
+            if (format == OUTPUT_SUMMARY && headerFound) printHeader(filename, &header, numberOfRecords);
+
+            memset(&header, 0, sizeof(detectionLogHeader_t));
+
+            memcpy(&header, data + position, MIN(headerSize, sizeof(detectionLogHeader_t)));
+
+            detectionLog.eventsEnabled = header.flags & DETECTION_LOG_FLAG_EVENTS;
+
+            detectionLog.timezoneMinutes = header.version >= UTC_VERSION ? header.timezoneMinutes : 0;
+
+            headerFound = true;
+
+            numberOfRecords = 0;
+
+            position += headerSize;
+
+            continue;
+
+        }
+
+        if (headerFound == false || size - position < header.recordSize) break;
+
+        detection_t record = {0};
+
+        memcpy(&record, data + position, MIN(header.recordSize, sizeof(detection_t)));
+
+        position += header.recordSize;
+
+        numberOfRecords += 1;
+
+        if (format == OUTPUT_CSV) printCSV(&header, &record);
+
+        if (format == OUTPUT_TEXT) {
+
+            detectionLog.entries[detectionLog.numberOfEntries] = record;
+
+            detectionLog.numberOfEntries += 1;
+
+            if (detectionLog.numberOfEntries == DETECTION_LOG_SIZE) flushText();
+
+        }
+
+    }
+
+    if (format == OUTPUT_TEXT) flushText();
+
+    if (format == OUTPUT_SUMMARY && headerFound) printHeader(filename, &header, numberOfRecords);
+
+    free(data);
+
+    if (position < size) fprintf(stderr, "%s: %s at byte %u\n", filename, headerFound ? "truncated or corrupt record" : "not a detection log", position);
+
+    return position == size;
+
+}
+
+int main(int argc, char **argv) {
+
+    outputFormat_t format = OUTPUT_TEXT;
+
+    int option;
+
+    while ((option = getopt(argc, argv, "cs")) != -1) {
+
+        switch (option) {
+        case 'c': format = OUTPUT_CSV; break;
+        case 's': format = OUTPUT_SUMMARY; break;
+        default: optind = argc + 1; break;
+        }
+
+    }
+
+    if (optind >= argc) {
+
+        fprintf(stderr, "Usage: %s [-c | -s] calls.bin ...\n\n", argv[0]);
+        fprintf(stderr, "  -c  Export the records as CSV with the serial number and model CRCs of their recording\n");
+        fprintf(stderr, "  -s  Print the header and the number of records of each recording\n");
+
+        return 1;
+
+    }
+
+    setvbuf(stdout, NULL, _IOFBF, OUTPUT_BUFFER_SIZE);
+
+    if (format == OUTPUT_CSV) printf("serial,model_crc,confirmer_crc,time,timezone_minutes,class,duration,frames,peak_score,mean_score\n");
+
+    bool success = true;
+
+    for (int i = optind; i < argc; i += 1) success &= decodeFile(argv[i], format);
+
+    return success ? 0 : 1;
+
+}
@@ -0,0 +1,160 @@
+/****************************************************************************
+ * gatecheck.c
+ * openacousticdevices.info
+ * October 2026
+ *****************************************************************************/
+
+/* Checks that the noise floor of the energy gate follows a background that
+ * ramps slowly up and down at low levels, that the gate stays closed on the
+ * background and that it opens on calls above the margin. It also checks
+ * that the largest margin does not overflow over a loud floor. */
+
+#include <math.h>
+#include <stdio.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include "detector.h"
+
+/* Background ramp: a mean square from RAMP_MINIMUM to RAMP_MAXIMUM and back,
+ * over RAMP_FRAMES frames each way, with a uniform spread of RAMP_SPREAD
+ * around it */
+
+#define RAMP_MINIMUM                            4.0
+#define RAMP_MAXIMUM                            64.0
+#define RAMP_FRAMES                             40000
+#define RAMP_SPREAD                             0.25
+
+/* The floor settles in the lower part of the spread, since it falls faster
+ * than it rises. It is checked after SETTLE_FRAMES frames */
+
+#define SETTLE_FRAMES                           2000
+#define FLOOR_MINIMUM_RATIO                     0.5
+#define FLOOR_MAXIMUM_RATIO                     1.25
+
+/* Gate checks at a margin of 6 dB: a call of CALL_RATIO times the background
+ * every CALL_INTERVAL frames must open it, and the background frames outside
+ * the hangover of the calls may open it at most MAXIMUM_FALSE_OPENINGS of
+ * the time */
+
+#define MARGIN_DB                               6.0
+#define CALL_RATIO                              10.0
+#define CALL_INTERVAL                           500
+#define MAXIMUM_FALSE_OPENINGS                  0.01
+
+/* Saturation check: a constant mean square at the largest margin must never
+ * open the gate. At this energy (an amplitude of about half full scale) the
+ * Q8 floor times the 60 dB margin, 2^16 * 10^6 * energy, just exceeds 2^64
+ * and wraps to less than the energy */
+
+#define OVERFLOW_ENERGY                         281474977u
+#define SATURATION_FRAMES                       100
+
+/* Linear congruential generator, for a reproducible spread */
+
+static uint32_t randomState = 1;
+
+static double uniformRandom(void) {
+
+    randomState = randomState * 1664525 + 1013904223;
+
+    return (double)(randomState >> 8) / (1 << 24);
+
+}
+
+int main(void) {
+
+    energyGate_t gate;
+
+    memset(&gate, 0, sizeof(energyGate_t));
+
+    uint32_t margin = (uint32_t)(ENERGY_GATE_MARGIN_ONE * pow(10.0, MARGIN_DB / 10.0) + 0.5);
+
+    double minimumRatio = INFINITY, maximumRatio = 0.0;
+
+    uint32_t numberOfCalls = 0, numberOfCallsMissed = 0;
+
+    uint32_t numberOfBackgroundFrames = 0, numberOfFalseOpenings = 0;
+
+    uint32_t framesSinceCall = ENERGY_GATE_HANGOVER_FRAMES;
+
+    for (uint32_t frame = 0; frame < 2 * RAMP_FRAMES; frame += 1) {
+
+        double position = frame < RAMP_FRAMES ? (double)frame / RAMP_FRAMES : (double)(2 * RAMP_FRAMES - frame) / RAMP_FRAMES;
+
+        double background = RAMP_MINIMUM * pow(RAMP_MAXIMUM / RAMP_MINIMUM, position);
+
+        bool call = frame % CALL_INTERVAL == CALL_INTERVAL - 1;
+
+        double energy = call ? CALL_RATIO * background : background * (1.0 + RAMP_SPREAD * (2.0 * uniformRandom() - 1.0));
+
+        bool open = Detector_applyEnergyGate(&gate, (uint32_t)(energy + 0.5), margin);
+
+        if (call) {
+
+            numberOfCalls += 1;
+
+            numberOfCallsMissed += open ? 0 : 1;
+
+            framesSinceCall = 0;
+
+        } else {
+
+            framesSinceCall += 1;
+
+            if (framesSinceCall >= ENERGY_GATE_HANGOVER_FRAMES) {
+
+                numberOfBackgroundFrames += 1;
+
+                numberOfFalseOpenings += open ? 1 : 0;
+
+            }
+
+        }
+
+        if (frame >= SETTLE_FRAMES) {
+
+            double ratio = (double)gate.noiseFloor / (1 << ENERGY_GATE_FLOOR_FRACTION_BITS) / background;
+
+            minimumRatio = fmin(minimumRatio, ratio);
+
+            maximumRatio = fmax(maximumRatio, ratio);
+
+        }
+
+    }
+
+    memset(&gate, 0, sizeof(energyGate_t));
+
+    uint32_t maximumMargin = (uint32_t)(ENERGY_GATE_MARGIN_ONE * pow(10.0, ENERGY_GATE_MAXIMUM_MARGIN_DB / 10.0) + 0.5);
+
+    uint32_t numberOfSaturatedOpenings = 0;
+
+    for (uint32_t frame = 0; frame < SATURATION_FRAMES; frame += 1) {
+
+        numberOfSaturatedOpenings += Detector_applyEnergyGate(&gate, OVERFLOW_ENERGY, maximumMargin) ? 1 : 0;
+
+    }
+
+    double falseOpenings = (double)numberOfFalseOpenings / numberOfBackgroundFrames;
+
+    bool floorPassed = minimumRatio >= FLOOR_MINIMUM_RATIO && maximumRatio <= FLOOR_MAXIMUM_RATIO;
+
+    bool callsPassed = numberOfCallsMissed == 0;
+
+    bool backgroundPassed = falseOpenings <= MAXIMUM_FALSE_OPENINGS;
+
+    bool saturationPassed = numberOfSaturatedOpenings == 0;
+
+    printf("Noise floor     : %.3f to %.3f of a background from %.0f to %.0f : %s\n", minimumRatio, maximumRatio, RAMP_MINIMUM, RAMP_MAXIMUM, floorPassed ? "OK" : "FAILED");
+
+    printf("Calls           : %u of %u missed at %.0f dB : %s\n", numberOfCallsMissed, numberOfCalls, MARGIN_DB, callsPassed ? "OK" : "FAILED");
+
+    printf("Background      : gate open on %.2f%% of the frames : %s\n", 100.0 * falseOpenings, backgroundPassed ? "OK" : "FAILED");
+
+    printf("Saturation      : gate open on %u of %u loud frames at %.0f dB : %s\n", numberOfSaturatedOpenings, SATURATION_FRAMES, ENERGY_GATE_MAXIMUM_MARGIN_DB, saturationPassed ? "OK" : "FAILED");
+
+    return floorPassed && callsPassed && backgroundPassed && saturationPassed ? 0 : 1;
+
+}
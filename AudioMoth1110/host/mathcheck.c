@@ -0,0 +1,183 @@
+/****************************************************************************
+ * mathcheck.c
+ * openacousticdevices.info
+ * October 2026
+ *****************************************************************************/
+
+/* Checks the documented error bounds of the fast math kernels and of the
+ * tanh table of the float network activations against the double-precision
+ * library over their input ranges. */
+
+#include <math.h>
+#include <stdio.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include "fastmath.h"
+#include "dsptables.h"
+
+/* Documented bounds (see fastmath.h) */
+
+#define LOG10_ABSOLUTE_BOUND                    1e-7
+#define LOG10_RELATIVE_BOUND                    1e-7
+#define EXP_RELATIVE_BOUND                      2.5e-7
+
+/* Linear interpolation error of the tanh table: the largest second derivative of tanh,
+ * 4 / (3 sqrt(3)), times the square of the step over 8, plus float rounding */
+
+#define TANH_STEP                               ((double)NN_TANH_TABLE_RANGE / NN_TANH_TABLE_SIZE)
+#define TANH_ABSOLUTE_BOUND                     (0.7698 * TANH_STEP * TANH_STEP / 8 + 1e-6)
+
+/* Sweep constants */
+
+#define LOG10_BIT_PATTERN_STEP                  7
+#define POSITIVE_INFINITY_BITS                  0x7F800000
+#define EXP_SWEEP_MINIMUM                       -87.33f
+#define EXP_SWEEP_MAXIMUM                       88.72f
+#define EXP_SWEEP_STEP                          1e-5f
+#define TANH_SWEEP_MAXIMUM                      (2 * NN_TANH_TABLE_RANGE)
+#define TANH_SWEEP_STEP                         1e-4f
+#define VECTOR_MAXIMUM_SIZE                     9
+
+/* Tanh by interpolation in the table, as in detector.c */
+
+static double tableTanh(float x) {
+
+    float position = fabsf(x) * NN_TANH_TABLE_SIZE / NN_TANH_TABLE_RANGE;
+
+    float value = 1.0f;
+
+    if (position < NN_TANH_TABLE_SIZE) {
+
+        uint32_t index = (uint32_t)position;
+
+        value = DSPTables_tanh[index] + (position - index) * (DSPTables_tanh[index + 1] - DSPTables_tanh[index]);
+
+    }
+
+    return x < 0 ? -value : value;
+
+}
+
+int main(void) {
+
+    double log10AbsoluteError = 0.0, log10RelativeError = 0.0, expRelativeError = 0.0;
+
+    float log10AbsoluteWorst = 0.0f, log10RelativeWorst = 0.0f, expWorst = 0.0f;
+
+    /* Every seventh positive float bit pattern, subnormals included */
+
+    for (uint32_t bits = 1; bits < POSITIVE_INFINITY_BITS; bits += LOG10_BIT_PATTERN_STEP) {
+
+        float x;
+
+        memcpy(&x, &bits, sizeof(x));
+
+        double reference = log10((double)x);
+
+        double error = fabs((double)FastMath_log10f(x) - reference);
+
+        if (fabs(reference) <= 1.0) {
+
+            if (error > log10AbsoluteError) {
+
+                log10AbsoluteError = error;
+
+                log10AbsoluteWorst = x;
+
+            }
+
+        } else if (error / fabs(reference) > log10RelativeError) {
+
+            log10RelativeError = error / fabs(reference);
+
+            log10RelativeWorst = x;
+
+        }
+
+    }
+
+    /* Dense sweep of the finite output range of exp */
+
+    for (float x = EXP_SWEEP_MINIMUM; x <= EXP_SWEEP_MAXIMUM; x += EXP_SWEEP_STEP * (1.0f + fabsf(x))) {
+
+        double reference = exp((double)x);
+
+        double error = fabs((double)FastMath_expf(x) - reference) / reference;
+
+        if (error > expRelativeError) {
+
+            expRelativeError = error;
+
+            expWorst = x;
+
+        }
+
+    }
+
+    /* Tanh table over twice its range, to cover the saturation */
+
+    double tanhError = 0.0;
+
+    float tanhWorst = 0.0f;
+
+    for (float x = -TANH_SWEEP_MAXIMUM; x <= TANH_SWEEP_MAXIMUM; x += TANH_SWEEP_STEP) {
+
+        double error = fabs(tableTanh(x) - tanh((double)x));
+
+        if (error > tanhError) {
+
+            tanhError = error;
+
+            tanhWorst = x;
+
+        }
+
+    }
+
+    /* Vector versions, in place, against the scalar functions for every remainder of the unrolling */
+
+    bool vectorPassed = true;
+
+    for (uint32_t size = 0; size <= VECTOR_MAXIMUM_SIZE; size += 1) {
+
+        float32_t logValues[VECTOR_MAXIMUM_SIZE + 1], expValues[VECTOR_MAXIMUM_SIZE + 1];
+
+        for (uint32_t i = 0; i <= VECTOR_MAXIMUM_SIZE; i += 1) logValues[i] = expValues[i] = 0.5f + i;
+
+        FastMath_vlog10_f32(logValues, logValues, size);
+
+        FastMath_vexp_f32(expValues, expValues, size);
+
+        for (uint32_t i = 0; i <= VECTOR_MAXIMUM_SIZE; i += 1) {
+
+            vectorPassed &= logValues[i] == (i < size ? FastMath_log10f(0.5f + i) : 0.5f + i);
+
+            vectorPassed &= expValues[i] == (i < size ? FastMath_expf(0.5f + i) : 0.5f + i);
+
+        }
+
+    }
+
+    bool log10Passed = log10AbsoluteError < LOG10_ABSOLUTE_BOUND && log10RelativeError < LOG10_RELATIVE_BOUND;
+
+    bool expPassed = expRelativeError < EXP_RELATIVE_BOUND;
+
+    bool tanhPassed = tanhError < TANH_ABSOLUTE_BOUND;
+
+    bool specialPassed = isinf(FastMath_log10f(0.0f)) && isnan(FastMath_log10f(-1.0f)) && isinf(FastMath_expf(89.0f)) && FastMath_expf(-88.0f) == 0.0f;
+
+    printf("FastMath_log10f : absolute error %.3g (at %g), relative error %.3g (at %g) : %s\n", log10AbsoluteError, log10AbsoluteWorst, log10RelativeError, log10RelativeWorst, log10Passed ? "OK" : "FAILED");
+
+    printf("FastMath_expf   : relative error %.3g (at %g) : %s\n", expRelativeError, expWorst, expPassed ? "OK" : "FAILED");
+
+    printf("Tanh table      : absolute error %.3g (at %g), %u steps : %s\n", tanhError, tanhWorst, NN_TANH_TABLE_SIZE, tanhPassed ? "OK" : "FAILED");
+
+    printf("Special values  : %s\n", specialPassed ? "OK" : "FAILED");
+
+    printf("Vector versions : sizes 0 to %u : %s\n", VECTOR_MAXIMUM_SIZE, vectorPassed ? "OK" : "FAILED");
+
+    return log10Passed && expPassed && tanhPassed && specialPassed && vectorPassed ? 0 : 1;
+
+}
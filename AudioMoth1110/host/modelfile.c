@@ -0,0 +1,52 @@
+/****************************************************************************
+ * modelfile.c
+ * openacousticdevices.info
+ * October 2026
+ *****************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "modelfile.h"
+
+/* Size of a model image, word aligned as on the device */
+
+#define IMAGE_SIZE                              (NN_MODEL_MAXIMUM_SIZE + sizeof(uint32_t))
+
+bool ModelFile_read(const char *filename, nnModel_t *model, uint32_t numberOfInputs) {
+
+    uint32_t *image = malloc(IMAGE_SIZE);
+
+    FILE *file = image ? fopen(filename, "rb") : NULL;
+
+    if (file == NULL) {
+
+        fprintf(stderr, "Could not open %s\n", filename);
+
+        free(image);
+
+        return false;
+
+    }
+
+    /* Reading one word more than the maximum detects files that are too large */
+
+    uint32_t size = (uint32_t)fread(image, 1, IMAGE_SIZE, file);
+
+    fclose(file);
+
+    nnModelStatus_t status = NNModel_parse(model, image, size, numberOfInputs);
+
+    if (status != NN_MODEL_OK) {
+
+        fprintf(stderr, "Could not load %s: %s\n", filename, NNModel_describeStatus(status));
+
+        free(image);
+
+        return false;
+
+    }
+
+    return true;
+
+}
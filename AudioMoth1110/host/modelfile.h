@@ -0,0 +1,18 @@
+/****************************************************************************
+ * modelfile.h
+ * openacousticdevices.info
+ * October 2026
+ *****************************************************************************/
+
+#ifndef __MODELFILE_H
+#define __MODELFILE_H
+
+#include <stdbool.h>
+
+#include "nnmodel.h"
+
+/* Read and validate a model file as the firmware does at boot. Each image is kept for the life of the tool, so the gate and the confirmer of a cascade can both be loaded. */
+
+bool ModelFile_read(const char *filename, nnModel_t *model, uint32_t numberOfInputs);
+
+#endif /* __MODELFILE_H */
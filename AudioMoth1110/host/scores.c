@@ -0,0 +1,172 @@
+/****************************************************************************
+ * scores.c
+ * openacousticdevices.info
+ * October 2026
+ *****************************************************************************/
+
+/* Runs the detector over a WAV file, frame by frame as makeRecording does,
+ * and prints the time and neural network score of every frame. The model is
+ * the built-in one unless a model file is given with -m, and the score is the
+ * probability of class 0 unless another class is chosen with -c. With a
+ * confirmer model given with -k, the score is that of the confirmer over the
+ * MFCC window ending at the frame (0 until the window first fills), to tune
+ * the thresholds of the cascade. Otherwise the frames are scored in batches
+ * of NN_MAXIMUM_BATCH_SIZE with Detector_neuralNetworkBatch. */
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "detector.h"
+#include "wavfile.h"
+#include "nnmodel.h"
+#include "modelfile.h"
+
+#define SAMPLE_RATE                             32000
+
+/* Detector state */
+
+static detectorArena_t detectorArena;
+
+static nnModel_t model;
+
+static nnModel_t confirmerModel;
+
+static neuralNetworkBatch_t batch;
+
+static float32_t batchFrames[NN_MAXIMUM_BATCH_SIZE][NUMBER_OF_FEATURES];
+
+static float32_t batchFeatures[NUMBER_OF_FEATURES * NN_MAXIMUM_BATCH_SIZE];
+
+/* Score the frames gathered so far, one column of the input matrix per frame */
+
+static void scoreBatch(FILE *output, uint32_t firstFrame, uint32_t numberOfFrames, uint32_t scoredClass) {
+
+    for (uint32_t i = 0; i < NUMBER_OF_FEATURES; i += 1) {
+
+        for (uint32_t frame = 0; frame < numberOfFrames; frame += 1) {
+            batchFeatures[i * numberOfFrames + frame] = batchFrames[frame][i];
+        }
+
+    }
+
+    const float32_t *scores = Detector_neuralNetworkBatch(&batch, &detectorArena.neuralNetwork, &model, batchFeatures, numberOfFrames) + scoredClass * numberOfFrames;
+
+    for (uint32_t frame = 0; frame < numberOfFrames; frame += 1) {
+
+        fprintf(output, "%.3f %.7f\n", (double)(firstFrame + frame) * NUMBER_OF_SAMPLES_IN_FRAME / SAMPLE_RATE, scores[frame]);
+
+    }
+
+}
+
+static void printUsage(char *name) {
+
+    fprintf(stderr, "Usage: %s [-m model.bin] [-k confirmer.bin] [-c class] input.wav [output.txt]\n", name);
+
+}
+
+int main(int argc, char **argv) {
+
+    int option;
+
+    uint32_t scoredClass = 0;
+
+    bool confirmerScores = false;
+
+    NNModel_loadDefault(&model);
+
+    while ((option = getopt(argc, argv, "m:k:c:")) != -1) {
+
+        switch (option) {
+        case 'm': if (!ModelFile_read(optarg, &model, NUMBER_OF_FEATURES)) return 1; break;
+        case 'k': if (!ModelFile_read(optarg, &confirmerModel, NN_CONFIRMER_NUMBER_OF_FEATURES)) return 1; confirmerScores = true; break;
+        case 'c': scoredClass = (uint32_t)atoi(optarg); break;
+        default: printUsage(argv[0]); return 1;
+        }
+
+    }
+
+    const nnModel_t *scoredModel = confirmerScores ? &confirmerModel : &model;
+
+    if (scoredClass >= scoredModel->numberOfClasses) {
+
+        fprintf(stderr, "The model has %u classes\n", scoredModel->numberOfClasses);
+
+        return 1;
+
+    }
+
+    if (optind >= argc) {
+
+        printUsage(argv[0]);
+
+        return 1;
+
+    }
+
+    int16_t *audio;
+
+    uint32_t numberOfSamples;
+
+    if (!WavFile_read(argv[optind], SAMPLE_RATE, &audio, &numberOfSamples)) {
+
+        fprintf(stderr, "Could not read %s\n", argv[optind]);
+
+        return 1;
+
+    }
+
+    FILE *output = argc > optind + 1 ? fopen(argv[optind + 1], "w") : stdout;
+
+    if (output == NULL) {
+
+        fprintf(stderr, "Could not open %s\n", argv[optind + 1]);
+
+        return 1;
+
+    }
+
+    Detector_resetArena(&detectorArena);
+
+    uint32_t numberOfFrames = numberOfSamples / NUMBER_OF_SAMPLES_IN_FRAME;
+
+    for (uint32_t frame = 0; frame < numberOfFrames; frame += 1) {
+
+        Detector_MFCC(&detectorArena.featureExtractor, audio + frame * NUMBER_OF_SAMPLES_IN_FRAME, Detector_advanceHistory(&detectorArena.mfccHistory));
+
+        float32_t *features = Detector_deltas(&detectorArena.mfccHistory);
+
+        if (confirmerScores) {
+
+            Detector_neuralNetwork(&detectorArena.neuralNetwork, &model, features);
+
+            Detector_updateWindow(&detectorArena.mfccWindow, &detectorArena.mfccHistory);
+
+            float32_t *windowFeatures = Detector_windowFeatures(&detectorArena.mfccWindow);
+
+            float32_t score = windowFeatures ? Detector_neuralNetwork(&detectorArena.neuralNetwork, &confirmerModel, windowFeatures)[scoredClass] : 0.0f;
+
+            fprintf(output, "%.3f %.7f\n", (double)frame * NUMBER_OF_SAMPLES_IN_FRAME / SAMPLE_RATE, score);
+
+            continue;
+
+        }
+
+        uint32_t column = frame % NN_MAXIMUM_BATCH_SIZE;
+
+        memcpy(batchFrames[column], features, sizeof(batchFrames[0]));
+
+        if (column == NN_MAXIMUM_BATCH_SIZE - 1 || frame == numberOfFrames - 1) scoreBatch(output, frame - column, column + 1, scoredClass);
+
+    }
+
+    if (output != stdout) fclose(output);
+
+    free(audio);
+
+    return 0;
+
+}
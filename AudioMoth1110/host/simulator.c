@@ -0,0 +1,869 @@
+/****************************************************************************
+ * simulator.c
+ * openacousticdevices.info
+ * October 2026
+ *****************************************************************************/
+
+/* Replays a WAV file through a model of the firmware's SRAM buffer ring. A
+ * producer thread stands in for the DMA interrupt and fills buffers[] at the
+ * sample rate (optionally accelerated), while the main thread runs the same
+ * consumer loop as makeRecording: MFCC, deltas and neural network (and, with
+ * a confirmer model, the cascade) on every buffer not skipped by the energy
+ * or frequency gates and one SD card write per superbuffer (or, in clip
+ * capture mode, per superbuffer around a detection). The lag of readBuffer behind
+ * writeBuffer is reported over time. */
+
+#include <math.h>
+#include <time.h>
+#include <stdio.h>
+#include <errno.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+#include <unistd.h>
+#include <pthread.h>
+
+#include "detector.h"
+#include "profiler.h"
+#include "wavfile.h"
+#include "nnmodel.h"
+#include "modelfile.h"
+#include "detectionlog.h"
+
+/* Size of the buffer the detections are formatted in (as the compression buffer in main.c) */
+
+#define DETECTION_BUFFER_SIZE                   512
+
+/* SRAM buffer constants (as in main.c) */
+
+#define NUMBER_OF_BUFFERS                       128
+#define NUMBER_OF_SAMPLES_IN_BUFFER             NUMBER_OF_SAMPLES_IN_FRAME
+
+#define NUMBER_OF_SUPERBUFFERS                  8
+#define NUMBER_OF_BUFFERS_IN_SUPERBUFFER        (NUMBER_OF_BUFFERS / NUMBER_OF_SUPERBUFFERS)
+
+#define NUMBER_OF_BYTES_IN_SAMPLE               2
+
+/* Simulation defaults */
+
+#define DEFAULT_SAMPLE_RATE                     32000
+#define DEFAULT_SAMPLES_IN_DMA_TRANSFER         64
+#define DEFAULT_REPORT_INTERVAL                 1.0
+#define DEFAULT_NN_THRESHOLD                    0.5f
+#define DEFAULT_NN_PRETHRESHOLD                 0.25f
+#define DEFAULT_NN_FREQUENCY_GATE_THRESHOLD     1.0f
+
+/* Frequency gate constants (as in main.c) */
+
+#define NN_FREQUENCY_GATE_WINDOW_LENGTH         128
+#define NN_FREQUENCY_GATE_HANGOVER_FRAMES       8
+
+/* Clip capture constants (as in main.c) */
+
+#define NN_CLIP_MAXIMUM_PREROLL_SUPERBUFFERS    (NUMBER_OF_SUPERBUFFERS / 2)
+
+#define MILLISECONDS_IN_SECOND                  1000
+#define NANOSECONDS_IN_SECOND                   1000000000LL
+#define NANOSECONDS_IN_MICROSECOND              1000LL
+#define MICROSECONDS_IN_MILLISECOND             1000.0
+
+/* Useful macros */
+
+#define MIN(a, b)                               ((a) < (b) ? (a) : (b))
+#define MAX(a, b)                               ((a) > (b) ? (a) : (b))
+
+/* Simulation settings */
+
+typedef struct {
+    char *inputFilename;
+    char *outputFilename;
+    char *profileFilename;
+    char *callsFilename;
+    bool binaryLog;
+    int32_t timezoneMinutes;
+    double speed;
+    double duration;
+    double reportInterval;
+    uint32_t sampleRate;
+    uint32_t samplesInDMATransfer;
+    double processingMicroseconds;
+    double writeMilliseconds;
+    float32_t thresholds[NN_MAXIMUM_NUMBER_OF_CLASSES];
+    float32_t preThreshold;
+    bool cascadeEnabled;
+    uint32_t energyGateMargin;
+    uint32_t frequencyGate;
+    float32_t frequencyGateThreshold;
+    bool clipCaptureEnabled;
+    double clipPreRoll;
+    double clipPostRoll;
+    bool eventsEnabled;
+    double eventGap;
+    double eventMinimum;
+} settings_t;
+
+/* SRAM buffer variables */
+
+static volatile uint32_t writeBuffer;
+
+static volatile uint32_t writeBufferIndex;
+
+static int16_t *buffers[NUMBER_OF_BUFFERS];
+
+static int16_t sram[NUMBER_OF_BUFFERS * NUMBER_OF_SAMPLES_IN_BUFFER];
+
+/* DMA buffers */
+
+static int16_t *primaryBuffer;
+
+static int16_t *secondaryBuffer;
+
+static uint32_t numberOfSamplesInDMATransfer;
+
+/* Shared state between the interrupt and the consumer loop */
+
+static volatile uint32_t readBuffer;
+
+static volatile uint32_t numberOfOverruns;
+
+static volatile bool recordingFinished;
+
+static pthread_mutex_t interruptMutex = PTHREAD_MUTEX_INITIALIZER;
+
+static pthread_cond_t interruptCondition = PTHREAD_COND_INITIALIZER;
+
+/* Source audio */
+
+static int16_t *audio;
+
+static uint32_t numberOfAudioSamples;
+
+static uint64_t numberOfSamplesToReplay;
+
+/* Detector state */
+
+static detectorArena_t detectorArena;
+
+static nnModel_t model;
+
+static nnModel_t confirmerModel;
+
+static detectionLog_t detectionLog;
+
+static detectionLogHeader_t detectionLogHeader;
+
+static bool detectionLogHeaderPending;
+
+/* Clock functions */
+
+static int64_t getNanoseconds(void) {
+
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return (int64_t)ts.tv_sec * NANOSECONDS_IN_SECOND + ts.tv_nsec;
+
+}
+
+static void sleepUntil(int64_t nanoseconds) {
+
+    struct timespec ts = {.tv_sec = nanoseconds / NANOSECONDS_IN_SECOND, .tv_nsec = nanoseconds % NANOSECONDS_IN_SECOND};
+
+    while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &ts, NULL) == EINTR);
+
+}
+
+static void spendTime(double microseconds, double speed) {
+
+    if (microseconds <= 0.0) return;
+
+    sleepUntil(getNanoseconds() + (int64_t)(microseconds * NANOSECONDS_IN_MICROSECOND / speed));
+
+}
+
+/* Interrupt handler, as in main.c with the digital filter replaced by a copy */
+
+static void AudioMoth_handleDirectMemoryAccessInterrupt(bool isPrimaryBuffer, int16_t **nextBuffer) {
+
+    int16_t *source = secondaryBuffer;
+
+    if (isPrimaryBuffer) source = primaryBuffer;
+
+    memcpy(buffers[writeBuffer] + writeBufferIndex, source, numberOfSamplesInDMATransfer * NUMBER_OF_BYTES_IN_SAMPLE);
+
+    writeBufferIndex += numberOfSamplesInDMATransfer;
+
+    if (writeBufferIndex == NUMBER_OF_SAMPLES_IN_BUFFER) {
+
+        writeBufferIndex = 0;
+
+        writeBuffer = (writeBuffer + 1) & (NUMBER_OF_BUFFERS - 1);
+
+        /* The ring has overflowed if the buffer now being filled is one the consumer has not read yet */
+
+        if (writeBuffer == readBuffer) numberOfOverruns += 1;
+
+    }
+
+}
+
+/* Producer thread standing in for the microphone and DMA controller */
+
+static void *dmaThread(void *arg) {
+
+    settings_t *settings = (settings_t*)arg;
+
+    double transferNanoseconds = (double)NANOSECONDS_IN_SECOND * numberOfSamplesInDMATransfer / settings->sampleRate / settings->speed;
+
+    int64_t startTime = getNanoseconds();
+
+    uint64_t position = 0;
+
+    bool isPrimaryBuffer = true;
+
+    for (uint64_t transfer = 1; position + numberOfSamplesInDMATransfer <= numberOfSamplesToReplay; transfer += 1) {
+
+        int16_t *dest = isPrimaryBuffer ? primaryBuffer : secondaryBuffer;
+
+        for (uint32_t i = 0; i < numberOfSamplesInDMATransfer; i += 1) {
+            dest[i] = audio[(position + i) % numberOfAudioSamples];
+        }
+
+        position += numberOfSamplesInDMATransfer;
+
+        sleepUntil(startTime + (int64_t)(transfer * transferNanoseconds));
+
+        pthread_mutex_lock(&interruptMutex);
+
+        AudioMoth_handleDirectMemoryAccessInterrupt(isPrimaryBuffer, NULL);
+
+        pthread_cond_signal(&interruptCondition);
+
+        pthread_mutex_unlock(&interruptMutex);
+
+        isPrimaryBuffer = !isPrimaryBuffer;
+
+    }
+
+    pthread_mutex_lock(&interruptMutex);
+
+    recordingFinished = true;
+
+    pthread_cond_signal(&interruptCondition);
+
+    pthread_mutex_unlock(&interruptMutex);
+
+    return NULL;
+
+}
+
+/* Wait for the next interrupt, as AudioMoth_sleep() does */
+
+static void AudioMoth_sleep(void) {
+
+    pthread_mutex_lock(&interruptMutex);
+
+    if (readBuffer == writeBuffer && !recordingFinished) pthread_cond_wait(&interruptCondition, &interruptMutex);
+
+    pthread_mutex_unlock(&interruptMutex);
+
+}
+
+/* Write a superbuffer to the output, as a clip or, if it is not part of one,
+ * as silence that the firmware compresses and does not spend time writing */
+
+static void writeSuperbuffer(uint64_t superbuffer, bool writeAudio, FILE *output, settings_t *settings) {
+
+    static int16_t silence[NUMBER_OF_BUFFERS_IN_SUPERBUFFER * NUMBER_OF_SAMPLES_IN_BUFFER];
+
+    int16_t *source = writeAudio ? buffers[(superbuffer & (NUMBER_OF_SUPERBUFFERS - 1)) * NUMBER_OF_BUFFERS_IN_SUPERBUFFER] : silence;
+
+    if (output) fwrite(source, NUMBER_OF_BYTES_IN_SAMPLE, NUMBER_OF_BUFFERS_IN_SUPERBUFFER * NUMBER_OF_SAMPLES_IN_BUFFER, output);
+
+    if (writeAudio) spendTime(settings->writeMilliseconds * MICROSECONDS_IN_MILLISECOND, settings->speed);
+
+}
+
+/* Append the detections kept in RAM to the calls file, as writeDetections() in main.c */
+
+static void writeDetections(FILE *calls, bool binaryLog) {
+
+    static char buffer[DETECTION_BUFFER_SIZE];
+
+    uint32_t length;
+
+    if (detectionLog.numberOfEntries == 0) return;
+
+    if (detectionLogHeaderPending && calls) fwrite(&detectionLogHeader, 1, sizeof(detectionLogHeader_t), calls);
+
+    detectionLogHeaderPending = false;
+
+    while ((length = binaryLog ? DetectionLog_encode(&detectionLog, (uint8_t*)buffer, DETECTION_BUFFER_SIZE) : DetectionLog_format(&detectionLog, buffer, DETECTION_BUFFER_SIZE)) > 0) {
+
+        if (calls) fwrite(buffer, 1, length, calls);
+
+    }
+
+}
+
+/* Frequency trigger, a model of DigitalFilter_applyFrequencyTrigger(): the
+ * Goertzel magnitude of each Hamming windowed window of the buffer at the
+ * centre frequency, as a percentage of a full scale sine */
+
+static float32_t goertzelCoefficient;
+
+static float32_t hammingWindow[NN_FREQUENCY_GATE_WINDOW_LENGTH];
+
+static float32_t hammingWindowSum;
+
+static void setFrequencyTrigger(uint32_t sampleRate, uint32_t frequency) {
+
+    goertzelCoefficient = 2.0f * cosf(2.0f * PI * frequency / sampleRate);
+
+    hammingWindowSum = 0.0f;
+
+    for (uint32_t i = 0; i < NN_FREQUENCY_GATE_WINDOW_LENGTH; i += 1) {
+
+        hammingWindow[i] = 0.54f - 0.46f * cosf(2.0f * PI * i / (NN_FREQUENCY_GATE_WINDOW_LENGTH - 1));
+
+        hammingWindowSum += hammingWindow[i];
+
+    }
+
+}
+
+static bool applyFrequencyTrigger(int16_t *buffer, uint32_t size, float32_t percentageThreshold) {
+
+    for (uint32_t start = 0; start + NN_FREQUENCY_GATE_WINDOW_LENGTH <= size; start += NN_FREQUENCY_GATE_WINDOW_LENGTH) {
+
+        float32_t d1 = 0.0f, d2 = 0.0f;
+
+        for (uint32_t i = 0; i < NN_FREQUENCY_GATE_WINDOW_LENGTH; i += 1) {
+
+            float32_t d0 = hammingWindow[i] * buffer[start + i] + goertzelCoefficient * d1 - d2;
+
+            d2 = d1;
+
+            d1 = d0;
+
+        }
+
+        float32_t magnitude = sqrtf(MAX(0.0f, d1 * d1 + d2 * d2 - goertzelCoefficient * d1 * d2));
+
+        if (100.0f * 2.0f * magnitude / hammingWindowSum / INT16_MAX > percentageThreshold) return true;
+
+    }
+
+    return false;
+
+}
+
+static uint32_t bufferLag(void) {
+
+    return (writeBuffer - readBuffer) & (NUMBER_OF_BUFFERS - 1);
+
+}
+
+/* Threshold option: "value" sets class 0 and "class=value" any class */
+
+static bool parseThreshold(char *text, float32_t *thresholds) {
+
+    char *separator = strchr(text, '=');
+
+    uint32_t thresholdClass = separator ? (uint32_t)atoi(text) : 0;
+
+    if (thresholdClass >= NN_MAXIMUM_NUMBER_OF_CLASSES) return false;
+
+    thresholds[thresholdClass] = (float32_t)atof(separator ? separator + 1 : text);
+
+    return true;
+
+}
+
+static void printUsage(char *name) {
+
+    fprintf(stderr, "Usage: %s [options] input.wav\n\n", name);
+    fprintf(stderr, "  -s speed     Replay speed relative to real time (default 1)\n");
+    fprintf(stderr, "  -d seconds   Length of the session, looping the file if needed (default: file length)\n");
+    fprintf(stderr, "  -r rate      Sample rate of the recording in Hz (default %u)\n", DEFAULT_SAMPLE_RATE);
+    fprintf(stderr, "  -t samples   Samples delivered by each DMA transfer (default %u)\n", DEFAULT_SAMPLES_IN_DMA_TRANSFER);
+    fprintf(stderr, "  -p us        Additional device processing time per buffer in microseconds (default 0)\n");
+    fprintf(stderr, "  -w ms        SD card write time per superbuffer in milliseconds (default 0)\n");
+    fprintf(stderr, "  -o file      Write the superbuffers to this file (default: none)\n");
+    fprintf(stderr, "  -l file      Write the detections to this file as calls.txt, timed from 1970/01/01 (default: none)\n");
+    fprintf(stderr, "  -L file      Write the detections to this file as calls.bin, to be read by objects/decodelog\n");
+    fprintf(stderr, "  -z minutes   Timezone offset of the local time of the detections from UTC (default 0)\n");
+    fprintf(stderr, "  -f file      Append the per-stage profile to this file (builds with PROFILE=1)\n");
+    fprintf(stderr, "  -n value     Neural network threshold of class 0 (default %.2f), or class=value for\n", DEFAULT_NN_THRESHOLD);
+    fprintf(stderr, "               any class (repeatable; classes without a threshold are not detected)\n");
+    fprintf(stderr, "  -m file      Neural network model file (default: built-in model)\n");
+    fprintf(stderr, "  -k file      Confirmer model file, to run the detector as a cascade (default: none)\n");
+    fprintf(stderr, "  -g value     Pre-threshold of the cascade gate (default %.2f)\n", DEFAULT_NN_PRETHRESHOLD);
+    fprintf(stderr, "  -e dB        Skip the buffers less than this margin over the noise floor, up to 60 (default: no energy gate)\n");
+    fprintf(stderr, "  -b Hz[,pct]  Skip the buffers without this frequency over the threshold percentage (default %.1f%%)\n", DEFAULT_NN_FREQUENCY_GATE_THRESHOLD);
+    fprintf(stderr, "               of full scale (default: no frequency gate)\n");
+    fprintf(stderr, "  -c pre,post  Write only the superbuffers from pre seconds before to post seconds after each\n");
+    fprintf(stderr, "               detection (pre-roll of at most %.3f s); -o then writes the rest as silence\n", (double)NN_CLIP_MAXIMUM_PREROLL_SUPERBUFFERS * NUMBER_OF_BUFFERS_IN_SUPERBUFFER * NUMBER_OF_SAMPLES_IN_BUFFER / DEFAULT_SAMPLE_RATE);
+    fprintf(stderr, "  -a gap,min   Log events merged over gaps of up to gap seconds and at least min seconds long\n");
+    fprintf(stderr, "               (default: one line per detected frame)\n");
+    fprintf(stderr, "  -i seconds   Reporting interval in recording time (default %.1f)\n", DEFAULT_REPORT_INTERVAL);
+
+}
+
+int main(int argc, char **argv) {
+
+    settings_t settings = {
+        .speed = 1.0,
+        .duration = 0.0,
+        .reportInterval = DEFAULT_REPORT_INTERVAL,
+        .sampleRate = DEFAULT_SAMPLE_RATE,
+        .samplesInDMATransfer = DEFAULT_SAMPLES_IN_DMA_TRANSFER,
+        .preThreshold = DEFAULT_NN_PRETHRESHOLD,
+        .frequencyGateThreshold = DEFAULT_NN_FREQUENCY_GATE_THRESHOLD
+    };
+
+    for (uint32_t i = 0; i < NN_MAXIMUM_NUMBER_OF_CLASSES; i += 1) settings.thresholds[i] = i == 0 ? DEFAULT_NN_THRESHOLD : INFINITY;
+
+    int option;
+
+    NNModel_loadDefault(&model);
+
+    while ((option = getopt(argc, argv, "s:d:r:t:p:w:o:l:L:z:f:n:m:k:g:e:b:c:a:i:")) != -1) {
+
+        switch (option) {
+        case 's': settings.speed = atof(optarg); break;
+        case 'd': settings.duration = atof(optarg); break;
+        case 'r': settings.sampleRate = (uint32_t)atoi(optarg); break;
+        case 't': settings.samplesInDMATransfer = (uint32_t)atoi(optarg); break;
+        case 'p': settings.processingMicroseconds = atof(optarg); break;
+        case 'w': settings.writeMilliseconds = atof(optarg); break;
+        case 'o': settings.outputFilename = optarg; break;
+        case 'f': settings.profileFilename = optarg; break;
+        case 'l': settings.callsFilename = optarg; settings.binaryLog = false; break;
+        case 'L': settings.callsFilename = optarg; settings.binaryLog = true; break;
+        case 'z': settings.timezoneMinutes = atoi(optarg); break;
+        case 'n': if (!parseThreshold(optarg, settings.thresholds)) { printUsage(argv[0]); return 1; } break;
+        case 'm': if (!ModelFile_read(optarg, &model, NUMBER_OF_FEATURES)) return 1; break;
+        case 'k': if (!ModelFile_read(optarg, &confirmerModel, NN_CONFIRMER_NUMBER_OF_FEATURES)) return 1; settings.cascadeEnabled = true; break;
+        case 'g': settings.preThreshold = (float32_t)atof(optarg); break;
+        case 'e': settings.energyGateMargin = atof(optarg) > 0.0 ? (uint32_t)(ENERGY_GATE_MARGIN_ONE * pow(10.0, fmin(atof(optarg), ENERGY_GATE_MAXIMUM_MARGIN_DB) / 10.0) + 0.5) : 0; break;
+        case 'b': settings.frequencyGate = (uint32_t)atoi(optarg); if (strchr(optarg, ',')) settings.frequencyGateThreshold = (float32_t)atof(strchr(optarg, ',') + 1); break;
+        case 'c': settings.clipCaptureEnabled = true; settings.clipPreRoll = atof(optarg); settings.clipPostRoll = strchr(optarg, ',') ? atof(strchr(optarg, ',') + 1) : 0.0; break;
+        case 'a': settings.eventsEnabled = true; settings.eventGap = atof(optarg); settings.eventMinimum = strchr(optarg, ',') ? atof(strchr(optarg, ',') + 1) : 0.0; break;
+        case 'i': settings.reportInterval = atof(optarg); break;
+        default: printUsage(argv[0]); return 1;
+        }
+
+    }
+
+    if (optind >= argc || settings.speed <= 0.0 || settings.reportInterval <= 0.0) {
+
+        printUsage(argv[0]);
+
+        return 1;
+
+    }
+
+    settings.inputFilename = argv[optind];
+
+    /* As in makeRecording, the gate only has to pass the detected classes over the pre-threshold */
+
+    float32_t gateThresholds[NN_MAXIMUM_NUMBER_OF_CLASSES];
+
+    for (uint32_t i = 0; i < NN_MAXIMUM_NUMBER_OF_CLASSES; i += 1) {
+
+        gateThresholds[i] = settings.cascadeEnabled && isfinite(settings.thresholds[i]) ? settings.preThreshold : settings.thresholds[i];
+
+    }
+
+    setFrequencyTrigger(settings.sampleRate, MIN(settings.sampleRate / 2, settings.frequencyGate));
+
+    /* As in the firmware, each SRAM buffer must be filled by a whole number of DMA transfers */
+
+    numberOfSamplesInDMATransfer = settings.samplesInDMATransfer;
+
+    if (numberOfSamplesInDMATransfer == 0 || NUMBER_OF_SAMPLES_IN_BUFFER % numberOfSamplesInDMATransfer) {
+
+        fprintf(stderr, "DMA transfer size must divide the buffer size of %u samples\n", NUMBER_OF_SAMPLES_IN_BUFFER);
+
+        return 1;
+
+    }
+
+    if (!WavFile_read(settings.inputFilename, settings.sampleRate, &audio, &numberOfAudioSamples) || numberOfAudioSamples == 0) {
+
+        fprintf(stderr, "Could not read %s\n", settings.inputFilename);
+
+        return 1;
+
+    }
+
+    numberOfSamplesToReplay = settings.duration > 0.0 ? (uint64_t)(settings.duration * settings.sampleRate) : numberOfAudioSamples;
+
+    FILE *output = NULL;
+
+    if (settings.outputFilename) {
+
+        output = fopen(settings.outputFilename, "wb");
+
+        if (output == NULL) {
+
+            fprintf(stderr, "Could not open %s\n", settings.outputFilename);
+
+            return 1;
+
+        }
+
+    }
+
+    FILE *calls = NULL;
+
+    if (settings.callsFilename) {
+
+        calls = fopen(settings.callsFilename, settings.binaryLog ? "wb" : "w");
+
+        if (calls == NULL) {
+
+            fprintf(stderr, "Could not open %s\n", settings.callsFilename);
+
+            return 1;
+
+        }
+
+    }
+
+    /* Initialise buffers */
+
+    primaryBuffer = malloc(numberOfSamplesInDMATransfer * NUMBER_OF_BYTES_IN_SAMPLE);
+
+    secondaryBuffer = malloc(numberOfSamplesInDMATransfer * NUMBER_OF_BYTES_IN_SAMPLE);
+
+    buffers[0] = sram;
+
+    for (uint32_t i = 1; i < NUMBER_OF_BUFFERS; i += 1) {
+        buffers[i] = buffers[i - 1] + NUMBER_OF_SAMPLES_IN_BUFFER;
+    }
+
+    printf("Replaying %s: %.1f s at %u Hz, %.1fx real time, %u samples per DMA transfer\n", settings.inputFilename, (double)numberOfSamplesToReplay / settings.sampleRate, settings.sampleRate, settings.speed, numberOfSamplesInDMATransfer);
+
+    printf("Device model: %.1f us extra processing per buffer, %.1f ms per superbuffer write\n\n", settings.processingMicroseconds, settings.writeMilliseconds);
+
+    printf("%10s %12s %11s %10s %10s %10s\n", "Time (s)", "writeBuffer", "readBuffer", "Lag", "Max lag", "Overruns");
+
+    PROFILE_RESET();
+
+    Detector_resetArena(&detectorArena);
+
+    DetectionLog_reset(&detectionLog, 0, settings.timezoneMinutes);
+
+    DetectionLog_setEvents(&detectionLog, settings.eventsEnabled, (uint32_t)(MILLISECONDS_IN_SECOND * MAX(0.0, settings.eventGap)), (uint32_t)(MILLISECONDS_IN_SECOND * MAX(0.0, settings.eventMinimum)));
+
+    static const uint8_t serialNumber[DETECTION_LOG_SERIAL_NUMBER_SIZE];
+
+    DetectionLog_initialiseHeader(&detectionLog, &detectionLogHeader, serialNumber, settings.sampleRate);
+
+    detectionLogHeader.flags |= settings.cascadeEnabled ? DETECTION_LOG_FLAG_CASCADE : 0;
+
+    detectionLogHeader.modelCRC = model.crc;
+
+    detectionLogHeader.confirmerCRC = settings.cascadeEnabled ? confirmerModel.crc : 0;
+
+    detectionLogHeader.numberOfClasses = model.numberOfClasses;
+
+    memcpy(detectionLogHeader.thresholds, settings.thresholds, sizeof(detectionLogHeader.thresholds));
+
+    detectionLogHeaderPending = settings.binaryLog;
+
+    /* Start the DMA transfers */
+
+    pthread_t thread;
+
+    pthread_create(&thread, NULL, dmaThread, &settings);
+
+    /* Main recording loop */
+
+    uint64_t buffersProcessed = 0;
+
+    uint64_t numberOfDetections[NN_MAXIMUM_NUMBER_OF_CLASSES] = {0};
+
+    uint64_t numberOfConfirmerRuns = 0;
+
+    uint64_t numberOfFramesSkipped = 0;
+
+    uint32_t numberOfConsecutiveFramesSkipped = 0;
+
+    uint64_t numberOfFramesSkippedByFrequencyGate = 0;
+
+    uint32_t frequencyGateHangover = 0;
+
+    /* As in makeRecording, each superbuffer of a clip is decided once the pre-roll after it has been classified */
+
+    uint32_t superbufferSamples = NUMBER_OF_BUFFERS_IN_SUPERBUFFER * NUMBER_OF_SAMPLES_IN_BUFFER;
+
+    uint64_t clipPreRollSuperbuffers = MIN(NN_CLIP_MAXIMUM_PREROLL_SUPERBUFFERS, (uint64_t)ceil(MAX(0.0, settings.clipPreRoll) * settings.sampleRate / superbufferSamples));
+
+    uint64_t clipPostRollSuperbuffers = (uint64_t)ceil(MAX(0.0, settings.clipPostRoll) * settings.sampleRate / superbufferSamples);
+
+    uint64_t superbuffersProcessed = 0;
+
+    uint64_t clipEndSuperbuffer = 0;
+
+    uint64_t numberOfClipSuperbuffers = 0;
+
+    uint32_t numberOfPreRollOverruns = 0;
+
+    uint64_t lagSum = 0;
+
+    uint32_t maximumLag = 0;
+
+    uint32_t intervalMaximumLag = 0;
+
+    int64_t processingNanoseconds = 0;
+
+    double buffersPerReport = settings.reportInterval * settings.sampleRate / NUMBER_OF_SAMPLES_IN_BUFFER;
+
+    double nextReport = buffersPerReport;
+
+    uint64_t numberOfBuffersToProcess = numberOfSamplesToReplay / NUMBER_OF_SAMPLES_IN_BUFFER;
+
+    while (buffersProcessed < numberOfBuffersToProcess && !(recordingFinished && readBuffer == writeBuffer)) {
+
+        while (readBuffer != writeBuffer && buffersProcessed < numberOfBuffersToProcess) {
+
+            uint32_t lag = bufferLag();
+
+            lagSum += lag;
+
+            maximumLag = MAX(maximumLag, lag);
+
+            intervalMaximumLag = MAX(intervalMaximumLag, lag);
+
+            int64_t start = getNanoseconds();
+
+            if (settings.frequencyGate > 0 && applyFrequencyTrigger(buffers[readBuffer], NUMBER_OF_SAMPLES_IN_BUFFER, settings.frequencyGateThreshold)) frequencyGateHangover = NN_FREQUENCY_GATE_HANGOVER_FRAMES;
+
+            bool frequencyGateOpen = settings.frequencyGate == 0 || frequencyGateHangover > 0;
+
+            if (frequencyGateHangover > 0) frequencyGateHangover -= 1;
+
+            if (!frequencyGateOpen) numberOfFramesSkippedByFrequencyGate += 1;
+
+            int32_t detectedClass = NN_NO_DETECTION;
+
+            float32_t detectedScore = 0.0f;
+
+            bool energyGateOpen = settings.energyGateMargin == 0 || Detector_applyEnergyGate(&detectorArena.energyGate, Detector_frameEnergy(buffers[readBuffer]), settings.energyGateMargin);
+
+            if (!energyGateOpen) numberOfFramesSkipped += 1;
+
+            if (frequencyGateOpen && energyGateOpen) {
+
+                /* As in makeRecording, catch up the history with the skipped buffers the deltas need,
+                 * and start the confirmer window again after a longer gap */
+
+                if (settings.cascadeEnabled && numberOfConsecutiveFramesSkipped > NUMBER_OF_BUFFERS_MFCC - 1) Detector_resetWindow(&detectorArena.mfccWindow);
+
+                for (uint32_t k = MIN(numberOfConsecutiveFramesSkipped, NUMBER_OF_BUFFERS_MFCC - 1); k > 0; k -= 1) {
+
+                    Detector_MFCC(&detectorArena.featureExtractor, buffers[(readBuffer - k) & (NUMBER_OF_BUFFERS - 1)], Detector_advanceHistory(&detectorArena.mfccHistory));
+
+                    if (settings.cascadeEnabled) Detector_updateWindow(&detectorArena.mfccWindow, &detectorArena.mfccHistory);
+
+                }
+
+                numberOfConsecutiveFramesSkipped = 0;
+
+                Detector_MFCC(&detectorArena.featureExtractor, buffers[readBuffer], Detector_advanceHistory(&detectorArena.mfccHistory));
+
+                PROFILE_START(PROFILE_DELTAS);
+
+                float32_t *features = Detector_deltas(&detectorArena.mfccHistory);
+
+                PROFILE_STOP(PROFILE_DELTAS);
+
+                PROFILE_START(PROFILE_NEURAL_NETWORK);
+
+                const float32_t *NNoutputs = Detector_neuralNetwork(&detectorArena.neuralNetwork, &model, features);
+
+                PROFILE_STOP(PROFILE_NEURAL_NETWORK);
+
+                detectedClass = Detector_classify(NNoutputs, gateThresholds, model.numberOfClasses);
+
+                if (detectedClass != NN_NO_DETECTION) detectedScore = NNoutputs[detectedClass];
+
+                if (settings.cascadeEnabled) {
+
+                    Detector_updateWindow(&detectorArena.mfccWindow, &detectorArena.mfccHistory);
+
+                    if (detectedClass != NN_NO_DETECTION) {
+
+                        PROFILE_START(PROFILE_CONFIRMER);
+
+                        detectedClass = Detector_confirm(&detectorArena.neuralNetwork, &confirmerModel, &detectorArena.mfccWindow, settings.thresholds, &detectedScore);
+
+                        PROFILE_STOP(PROFILE_CONFIRMER);
+
+                        numberOfConfirmerRuns += 1;
+
+                    }
+
+                }
+
+            } else {
+
+                numberOfConsecutiveFramesSkipped += 1;
+
+            }
+
+            if (detectedClass != NN_NO_DETECTION) numberOfDetections[detectedClass] += 1;
+
+            DetectionLog_addFrame(&detectionLog, (uint32_t)(buffersProcessed * NUMBER_OF_SAMPLES_IN_BUFFER * MILLISECONDS_IN_SECOND / settings.sampleRate), detectedClass, detectedScore);
+
+            if (detectedClass != NN_NO_DETECTION) clipEndSuperbuffer = superbuffersProcessed + clipPostRollSuperbuffers + 1;
+
+            spendTime(settings.processingMicroseconds, settings.speed);
+
+            /* Write complete superbuffer */
+
+            if ((readBuffer + 1) % NUMBER_OF_BUFFERS_IN_SUPERBUFFER == 0) {
+
+                PROFILE_START(PROFILE_WRITE);
+
+                if (settings.clipCaptureEnabled == false) {
+
+                    writeSuperbuffer(superbuffersProcessed, true, output, &settings);
+
+                } else if (superbuffersProcessed >= clipPreRollSuperbuffers) {
+
+                    /* The producer must not have reached the superbuffer waiting for its pre-roll */
+
+                    uint64_t superbuffer = superbuffersProcessed - clipPreRollSuperbuffers;
+
+                    if ((clipPreRollSuperbuffers + 1) * NUMBER_OF_BUFFERS_IN_SUPERBUFFER + bufferLag() > NUMBER_OF_BUFFERS) numberOfPreRollOverruns += 1;
+
+                    writeSuperbuffer(superbuffer, superbuffer < clipEndSuperbuffer, output, &settings);
+
+                    numberOfClipSuperbuffers += superbuffer < clipEndSuperbuffer ? 1 : 0;
+
+                }
+
+                PROFILE_STOP(PROFILE_WRITE);
+
+                writeDetections(calls, settings.binaryLog);
+
+                superbuffersProcessed += 1;
+
+            }
+
+            processingNanoseconds += getNanoseconds() - start;
+
+            /* Increment buffer counters */
+
+            readBuffer = (readBuffer + 1) & (NUMBER_OF_BUFFERS - 1);
+
+            buffersProcessed += 1;
+
+            if (buffersProcessed >= nextReport) {
+
+                printf("%10.2f %12u %11u %10u %10u %10u\n", (double)buffersProcessed * NUMBER_OF_SAMPLES_IN_BUFFER / settings.sampleRate, writeBuffer, readBuffer, bufferLag(), intervalMaximumLag, numberOfOverruns);
+
+                intervalMaximumLag = 0;
+
+                nextReport += buffersPerReport;
+
+            }
+
+        }
+
+        AudioMoth_sleep();
+
+    }
+
+    pthread_join(thread, NULL);
+
+    /* Superbuffers of a clip still waiting for their pre-roll */
+
+    if (settings.clipCaptureEnabled) {
+
+        for (uint64_t superbuffer = superbuffersProcessed > clipPreRollSuperbuffers ? superbuffersProcessed - clipPreRollSuperbuffers : 0; superbuffer < superbuffersProcessed; superbuffer += 1) {
+
+            writeSuperbuffer(superbuffer, superbuffer < clipEndSuperbuffer, output, &settings);
+
+            numberOfClipSuperbuffers += superbuffer < clipEndSuperbuffer ? 1 : 0;
+
+        }
+
+    }
+
+    if (output) fclose(output);
+
+    DetectionLog_finish(&detectionLog);
+
+    writeDetections(calls, settings.binaryLog);
+
+    if (calls) fclose(calls);
+
+#ifdef ENABLE_PROFILING
+
+    if (settings.profileFilename) {
+
+        static char profileBuffer[1024];
+
+        FILE *profile = fopen(settings.profileFilename, "a");
+
+        if (profile) {
+
+            Profiler_formatReport(profileBuffer, sizeof(profileBuffer));
+
+            fprintf(profile, "%s\r\n%s\r\n", settings.inputFilename, profileBuffer);
+
+            fclose(profile);
+
+        }
+
+    }
+
+#endif
+
+    /* Summary */
+
+    double bufferMicroseconds = 1e6 * NUMBER_OF_SAMPLES_IN_BUFFER / settings.sampleRate / settings.speed;
+
+    double meanProcessingMicroseconds = buffersProcessed > 0 ? (double)processingNanoseconds / NANOSECONDS_IN_MICROSECOND / buffersProcessed : 0.0;
+
+    printf("\nBuffers processed       : %llu\n", (unsigned long long)buffersProcessed);
+    for (uint32_t i = 0; i < model.numberOfClasses; i += 1) {
+
+        if (isfinite(settings.thresholds[i])) printf("Detections of class %-4u: %llu\n", i, (unsigned long long)numberOfDetections[i]);
+
+    }
+
+    if (settings.cascadeEnabled) printf("Confirmer runs          : %llu (%.1f%% of buffers)\n", (unsigned long long)numberOfConfirmerRuns, buffersProcessed > 0 ? 100.0 * numberOfConfirmerRuns / buffersProcessed : 0.0);
+
+    if (settings.frequencyGate > 0) printf("Skipped by freq. gate   : %llu (%.1f%% of buffers)\n", (unsigned long long)numberOfFramesSkippedByFrequencyGate, buffersProcessed > 0 ? 100.0 * numberOfFramesSkippedByFrequencyGate / buffersProcessed : 0.0);
+
+    if (settings.energyGateMargin > 0) printf("Skipped by energy gate  : %llu (%.1f%% of buffers)\n", (unsigned long long)numberOfFramesSkipped, buffersProcessed > 0 ? 100.0 * numberOfFramesSkipped / buffersProcessed : 0.0);
+
+    if (settings.clipCaptureEnabled) printf("Clip superbuffers       : %llu of %llu (%u with the pre-roll overwritten)\n", (unsigned long long)numberOfClipSuperbuffers, (unsigned long long)superbuffersProcessed, numberOfPreRollOverruns);
+
+    if (settings.eventsEnabled) printf("Events discarded        : %u (shorter than %.2f s)\n", detectionLog.numberOfDiscardedEvents, settings.eventMinimum);
+
+    if (detectionLog.numberOfDropped > 0) printf("Detections dropped      : %u (detection log full)\n", detectionLog.numberOfDropped);
+
+    printf("Mean lag (buffers)      : %.2f\n", buffersProcessed > 0 ? (double)lagSum / buffersProcessed : 0.0);
+    printf("Maximum lag (buffers)   : %u of %u\n", maximumLag, NUMBER_OF_BUFFERS);
+    printf("Ring headroom (buffers) : %d\n", (int)NUMBER_OF_BUFFERS - 1 - (int)maximumLag);
+    printf("Overruns                : %u\n", numberOfOverruns);
+    printf("Mean time per buffer    : %.1f us of %.1f us (%.1f%% duty cycle at this replay speed)\n", meanProcessingMicroseconds, bufferMicroseconds, 100.0 * meanProcessingMicroseconds / bufferMicroseconds);
+
+    free(audio);
+
+    free(primaryBuffer);
+
+    free(secondaryBuffer);
+
+    return numberOfOverruns > 0 ? 2 : 0;
+
+}
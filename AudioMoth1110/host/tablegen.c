@@ -0,0 +1,447 @@
+/****************************************************************************
+ * tablegen.c
+ * openacousticdevices.info
+ * October 2026
+ *****************************************************************************/
+
+/* Generates src/dsptables.c, the constant DSP tables of the detector that
+ * are kept in flash rather than computed on the device. The sizes and the
+ * filterbank design come from detector.h so the tables follow any change of
+ * the pipeline dimensions or of the bands. With the kernels argument it
+ * generates src/nnkernels.c instead, the unrolled neural network layer
+ * kernels for the NN_KERNEL_SHAPES of detector.h.
+ *
+ * Usage: tablegen > ../src/dsptables.c
+ *        tablegen kernels > ../src/nnkernels.c */
+
+#include <math.h>
+#include <stdio.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "detector.h"
+
+#define PI_DOUBLE                               3.141592653589793238463
+
+#define NUMBER_OF_FLOATS_PER_LINE               4
+#define NUMBER_OF_Q7_VALUES_PER_LINE            16
+#define NUMBER_OF_Q15_VALUES_PER_LINE           8
+#define NUMBER_OF_Q31_VALUES_PER_LINE           4
+#define NUMBER_OF_INTEGERS_PER_LINE             8
+
+#define KERNEL_OUTPUTS_PER_GROUP                4
+
+#define MEL_SCALE_FACTOR                        1125.0
+#define MEL_CORNER_FREQUENCY                    700.0
+
+#define Q7_ONE                                  128.0
+#define Q7_MINIMUM                              -128
+#define Q7_MAXIMUM                              127
+
+#define Q15_ONE                                 32768.0
+#define Q15_MAXIMUM                             32767
+
+#define Q31_ONE                                 2147483648.0
+#define Q31_MAXIMUM                             2147483647LL
+
+/* Table writer. Q7, Q15 and Q31 tables hold the values rounded to 1.7, 1.15 and 1.31 format. Every
+ * table is 8-byte aligned so the vector kernels start on a double word */
+
+typedef enum {FLOAT_TABLE, Q7_TABLE, Q15_TABLE, Q31_TABLE, UINT16_TABLE} tableType_t;
+
+static const char *tableTypeNames[] = {"float32_t", "q7_t", "q15_t", "q31_t", "uint16_t"};
+
+static const uint32_t valuesPerLine[] = {NUMBER_OF_FLOATS_PER_LINE, NUMBER_OF_Q7_VALUES_PER_LINE, NUMBER_OF_Q15_VALUES_PER_LINE, NUMBER_OF_Q31_VALUES_PER_LINE, NUMBER_OF_INTEGERS_PER_LINE};
+
+static void writeTable(tableType_t type, const char *name, const char *comment, const double *values, uint32_t numberOfRows, uint32_t numberOfColumns) {
+
+    printf("/* %s */\n\n", comment);
+
+    printf("const %s %s[%u] __attribute__((aligned(8))) = {\n", tableTypeNames[type], name, numberOfRows * numberOfColumns);
+
+    for (uint32_t i = 0; i < numberOfRows * numberOfColumns; i += 1) {
+
+        bool firstInLine = i % valuesPerLine[type] == 0 || i % numberOfColumns == 0;
+
+        bool lastInLine = (i + 1) % valuesPerLine[type] == 0 || (i + 1) % numberOfColumns == 0;
+
+        if (i % numberOfColumns == 0 && i > 0) printf("\n");
+
+        printf("%s", firstInLine ? "    " : "");
+
+        if (type == FLOAT_TABLE) {
+
+            printf("% .9ef", values[i]);
+
+        } else if (type == Q7_TABLE) {
+
+            long value = lround(values[i] * Q7_ONE);
+
+            printf("%4ld", value > Q7_MAXIMUM ? Q7_MAXIMUM : value < Q7_MINIMUM ? Q7_MINIMUM : value);
+
+        } else if (type == Q15_TABLE) {
+
+            long value = lround(values[i] * Q15_ONE);
+
+            printf("%6ld", value > Q15_MAXIMUM ? Q15_MAXIMUM : value);
+
+        } else if (type == Q31_TABLE) {
+
+            long long value = llround(values[i] * Q31_ONE);
+
+            printf("%11lld", value > Q31_MAXIMUM ? Q31_MAXIMUM : value);
+
+        } else {
+
+            printf("%5ld", lround(values[i]));
+
+        }
+
+        printf("%s", i + 1 < numberOfRows * numberOfColumns ? "," : "");
+
+        printf(lastInLine ? "\n" : " ");
+
+    }
+
+    printf("};\n\n");
+
+}
+
+/* DCT-II matrix: row k - 1 holds W * cos(pi * (2n + 1) * k / (2N)) for k = 1..12 and the N = 40 filterbank energies */
+
+static void writeDCTMatrix(void) {
+
+    static double matrix[NUMBER_OF_SAMPLES_IN_BUFFERS_MFCC * (NBANKS - 1)];
+
+    const double N = NBANKS - 1;
+
+    const double W = sqrt(2.0 / N);
+
+    for (uint32_t k = 1; k < NUMBER_OF_SAMPLES_IN_BUFFERS_MFCC + 1; k += 1) {
+
+        for (uint32_t n = 0; n < NBANKS - 1; n += 1) {
+            matrix[(k - 1) * (NBANKS - 1) + n] = W * cos(PI_DOUBLE * (2 * n + 1) * k / (2.0 * N));
+        }
+
+    }
+
+    writeTable(FLOAT_TABLE, "DSPTables_dctMatrix", "DCT-II coefficients 1 to 12 of the log filterbank energies, scaled by sqrt(2 / N)", matrix, NUMBER_OF_SAMPLES_IN_BUFFERS_MFCC, NBANKS - 1);
+
+}
+
+/* Symmetric Hamming window of the frame in Q15, used by the fixed-point front end */
+
+static void writeHammingWindowQ15(void) {
+
+    static double window[NUMBER_OF_SAMPLES_IN_FRAME];
+
+    for (uint32_t i = 0; i < NUMBER_OF_SAMPLES_IN_FRAME; i += 1) {
+        window[i] = 0.54 - 0.46 * cos(2.0 * PI_DOUBLE * i / (NUMBER_OF_SAMPLES_IN_FRAME - 1));
+    }
+
+    writeTable(Q15_TABLE, "DSPTables_hammingWindowQ15", "Hamming window in Q15", window, 1, NUMBER_OF_SAMPLES_IN_FRAME);
+
+}
+
+/* Mel filterbank, with the same design as melfilterbanks(flow, fhigh, nbanks, f, fs, 0, n) in MATLAB/test_one_file.py
+ * and f = linspace(0, fs / 2, NFFT / 2). NBANKS triangles are designed and the first NBANKS - 1 are used by the
+ * detector. The nonzero weights of each band are contiguous, so the tables are a CSR matrix whose column indices
+ * are implicit: the first FFT bin of each band and the offset of each band in the concatenated weights. The
+ * fixed-point front end uses the weights of each band divided by the band maximum, to use the full Q31 range */
+
+static double linspace(double start, double stop, uint32_t number, uint32_t i) {
+
+    return i == number - 1 ? stop : start + i * (stop - start) / (number - 1);
+
+}
+
+static bool writeFilterbank(void) {
+
+    static double frequencies[NUMBER_OF_BINS_IN_FRAME];
+
+    static double hertz[NBANKS + 2];
+
+    static uint32_t indices[NBANKS + 2];
+
+    static double row[NUMBER_OF_BINS_IN_FRAME];
+
+    static double weights[NUMBER_OF_BINS_IN_FRAME * NBANKS];
+
+    static double normalisedWeights[NUMBER_OF_BINS_IN_FRAME * NBANKS];
+
+    static double maxima[NBANKS - 1];
+
+    static double starts[NBANKS - 1];
+
+    static double offsets[NBANKS];
+
+    const double flow = FILTERBANK_LOW_FREQUENCY;
+
+    const double fhigh = FILTERBANK_HIGH_FREQUENCY;
+
+    for (uint32_t i = 0; i < NUMBER_OF_BINS_IN_FRAME; i += 1) frequencies[i] = linspace(0.0, FILTERBANK_SAMPLE_RATE / 2.0, NUMBER_OF_BINS_IN_FRAME, i);
+
+    /* Band edges equally spaced on the Mel scale, and the first bin at or above each of them */
+
+    double melLow = MEL_SCALE_FACTOR * log(1.0 + flow / MEL_CORNER_FREQUENCY);
+
+    double melHigh = MEL_SCALE_FACTOR * log(1.0 + fhigh / MEL_CORNER_FREQUENCY);
+
+    for (uint32_t i = 0; i < NBANKS + 2; i += 1) {
+
+        hertz[i] = MEL_CORNER_FREQUENCY * (exp(linspace(melLow, melHigh, NBANKS + 2, i) / MEL_SCALE_FACTOR) - 1.0);
+
+        indices[i] = NUMBER_OF_BINS_IN_FRAME - 1;
+
+        for (uint32_t k = 0; k < NUMBER_OF_BINS_IN_FRAME; k += 1) {
+
+            if (frequencies[k] >= hertz[i]) {
+
+                indices[i] = k;
+
+                break;
+
+            }
+
+        }
+
+    }
+
+    /* Triangular bands, keeping the span of nonzero weights of each */
+
+    uint32_t numberOfWeights = 0;
+
+    for (uint32_t j = 0; j < NBANKS - 1; j += 1) {
+
+        double normalisation = FILTERBANK_AREA_NORMALISATION ? 2.0 / (frequencies[indices[j + 2]] - frequencies[indices[j]]) : 1.0;
+
+        uint32_t rising = indices[j + 1] - indices[j];
+
+        uint32_t falling = indices[j + 2] - indices[j + 1];
+
+        for (uint32_t k = 0; k < NUMBER_OF_BINS_IN_FRAME; k += 1) row[k] = 0.0;
+
+        for (uint32_t t = 0; t < rising; t += 1) row[indices[j] + t] = normalisation * t / rising;
+
+        for (uint32_t t = 0; t < falling; t += 1) row[indices[j + 1] + t] = normalisation * (1.0 - (double)t / falling);
+
+        uint32_t first = 0, last = 0;
+
+        for (uint32_t k = 0; k < NUMBER_OF_BINS_IN_FRAME; k += 1) {
+
+            if (row[k] != 0.0) {
+
+                if (last == 0) first = k;
+
+                last = k + 1;
+
+            }
+
+        }
+
+        starts[j] = first;
+
+        offsets[j] = numberOfWeights;
+
+        maxima[j] = 0.0;
+
+        for (uint32_t k = first; k < last; k += 1) if (row[k] > maxima[j]) maxima[j] = row[k];
+
+        for (uint32_t k = first; k < last; k += 1) {
+
+            normalisedWeights[numberOfWeights] = row[k] / maxima[j];
+
+            weights[numberOfWeights] = row[k];
+
+            numberOfWeights += 1;
+
+        }
+
+    }
+
+    offsets[NBANKS - 1] = numberOfWeights;
+
+    if (numberOfWeights != NUMBER_OF_FILTERBANK_WEIGHTS) {
+
+        fprintf(stderr, "The filterbank has %u weights: set NUMBER_OF_FILTERBANK_WEIGHTS in detector.h to %u\n", numberOfWeights, numberOfWeights);
+
+        return false;
+
+    }
+
+    writeTable(UINT16_TABLE, "DSPTables_filterbankStarts", "First FFT bin of each Mel band", starts, 1, NBANKS - 1);
+
+    writeTable(UINT16_TABLE, "DSPTables_filterbankOffsets", "Offset of each Mel band in the weights, followed by the number of weights", offsets, 1, NBANKS);
+
+    writeTable(FLOAT_TABLE, "DSPTables_filterbankWeights", "Nonzero weights of the Mel bands, band after band", weights, 1, numberOfWeights);
+
+    writeTable(FLOAT_TABLE, "DSPTables_filterbankMaxima", "Largest weight of each Mel band", maxima, 1, NBANKS - 1);
+
+    writeTable(Q31_TABLE, "DSPTables_filterbankWeightsQ31", "Weights of the Mel bands relative to the band maximum in Q31", normalisedWeights, 1, numberOfWeights);
+
+    return true;
+
+}
+
+/* Activation tables of the int8 network: tansig in Q7 over [-128, 127] steps of its input,
+ * and exp(-x) for the softmax over [0, 255] steps, scaled to the range of uint16_t. Then the
+ * tanh table of the float network (DETECTOR_TABLE_ACTIVATIONS) */
+
+static void writeActivationTables(void) {
+
+    double tansig[NN_ACTIVATION_TABLE_SIZE];
+
+    double exponential[NN_ACTIVATION_TABLE_SIZE];
+
+    for (uint32_t i = 0; i < NN_ACTIVATION_TABLE_SIZE; i += 1) {
+
+        double x = ((double)i - NN_ACTIVATION_TABLE_SIZE / 2) * NN_TANSIG_TABLE_STEP;
+
+        tansig[i] = 2.0 / (1.0 + exp(-2.0 * x)) - 1.0;
+
+        exponential[i] = UINT16_MAX * exp(-(double)i * NN_SOFTMAX_TABLE_STEP);
+
+    }
+
+    writeTable(Q7_TABLE, "DSPTables_tansigQ7", "Tansig of the requantised accumulators of the int8 network, from the most negative input", tansig, 1, NN_ACTIVATION_TABLE_SIZE);
+
+    writeTable(UINT16_TABLE, "DSPTables_softmaxExponential", "Exponential of minus the distance of each requantised logit to the largest one", exponential, 1, NN_ACTIVATION_TABLE_SIZE);
+
+    double hyperbolicTangent[NN_TANH_TABLE_SIZE + 1];
+
+    for (uint32_t i = 0; i <= NN_TANH_TABLE_SIZE; i += 1) {
+
+        hyperbolicTangent[i] = tanh((double)i * NN_TANH_TABLE_RANGE / NN_TANH_TABLE_SIZE);
+
+    }
+
+    writeTable(FLOAT_TABLE, "DSPTables_tanh", "Hyperbolic tangent of the float network activations, both ends of the range included", hyperbolicTangent, 1, NN_TANH_TABLE_SIZE + 1);
+
+}
+
+/* Unrolled layer kernel: the outputs are computed in groups of four accumulators that start from
+ * the biases, so each input is loaded once per group and the multiply-adds of a group are independent */
+
+static void writeKernel(uint32_t numberOfInputs, uint32_t numberOfOutputs) {
+
+    uint32_t groupSize = numberOfOutputs < KERNEL_OUTPUTS_PER_GROUP ? numberOfOutputs : KERNEL_OUTPUTS_PER_GROUP;
+
+    printf("/* %u inputs, %u outputs */\n\n", numberOfInputs, numberOfOutputs);
+
+    printf("static void denseLayer%ux%u(const float32_t *weights, const float32_t *biases, const float32_t *input, float32_t *output) {\n\n", numberOfInputs, numberOfOutputs);
+
+    printf("    float32_t x");
+
+    for (uint32_t j = 0; j < groupSize; j += 1) printf(", a%u", j);
+
+    printf(";\n");
+
+    for (uint32_t group = 0; group < numberOfOutputs; group += groupSize) {
+
+        uint32_t numberInGroup = numberOfOutputs - group < groupSize ? numberOfOutputs - group : groupSize;
+
+        printf("\n");
+
+        for (uint32_t j = 0; j < numberInGroup; j += 1) printf("    a%u = biases[%u];\n", j, group + j);
+
+        for (uint32_t k = 0; k < numberOfInputs; k += 1) {
+
+            printf("    x = input[%u];", k);
+
+            for (uint32_t j = 0; j < numberInGroup; j += 1) printf(" a%u += weights[%u] * x;", j, (group + j) * numberOfInputs + k);
+
+            printf("\n");
+
+        }
+
+        for (uint32_t j = 0; j < numberInGroup; j += 1) printf("    output[%u] = a%u;\n", group + j, j);
+
+    }
+
+    printf("\n}\n\n");
+
+}
+
+static bool writeKernels(void) {
+
+    static const uint16_t shapes[][2] = NN_KERNEL_SHAPES;
+
+    const uint32_t numberOfShapes = sizeof(shapes) / sizeof(shapes[0]);
+
+    for (uint32_t i = 0; i < numberOfShapes; i += 1) {
+
+        uint32_t maximumInputs = NUMBER_OF_FEATURES > NN_MAXIMUM_LAYER_WIDTH ? NUMBER_OF_FEATURES : NN_MAXIMUM_LAYER_WIDTH;
+
+        bool repeated = false;
+
+        for (uint32_t j = 0; j < i; j += 1) repeated |= shapes[j][0] == shapes[i][0] && shapes[j][1] == shapes[i][1];
+
+        if (shapes[i][0] == 0 || shapes[i][0] > maximumInputs || shapes[i][1] == 0 || shapes[i][1] > NN_MAXIMUM_LAYER_WIDTH || repeated) {
+
+            fprintf(stderr, "NN_KERNEL_SHAPES in detector.h: shape {%u, %u} is repeated or does not fit a layer\n", shapes[i][0], shapes[i][1]);
+
+            return false;
+
+        }
+
+        writeKernel(shapes[i][0], shapes[i][1]);
+
+    }
+
+    printf("/* Kernels by layer shape */\n\n");
+
+    printf("static const struct {\n    uint16_t numberOfInputs;\n    uint16_t numberOfOutputs;\n    nnKernel_t kernel;\n} kernels[%u] = {\n", numberOfShapes);
+
+    for (uint32_t i = 0; i < numberOfShapes; i += 1) printf("    {%u, %u, denseLayer%ux%u}%s\n", shapes[i][0], shapes[i][1], shapes[i][0], shapes[i][1], i + 1 < numberOfShapes ? "," : "");
+
+    printf("};\n\n");
+
+    printf("nnKernel_t NNKernels_find(uint32_t numberOfInputs, uint32_t numberOfOutputs) {\n\n");
+
+    printf("    for (uint32_t i = 0; i < %u; i += 1) {\n\n", numberOfShapes);
+
+    printf("        if (kernels[i].numberOfInputs == numberOfInputs && kernels[i].numberOfOutputs == numberOfOutputs) return kernels[i].kernel;\n\n");
+
+    printf("    }\n\n    return NULL;\n\n}\n");
+
+    return true;
+
+}
+
+int main(int argc, char **argv) {
+
+    bool kernels = argc > 1 && strcmp(argv[1], "kernels") == 0;
+
+    printf("/****************************************************************************\n");
+    printf(" * %s\n", kernels ? "nnkernels.c" : "dsptables.c");
+    printf(" * openacousticdevices.info\n");
+    printf(" * October 2026\n");
+    printf(" *****************************************************************************/\n\n");
+
+    printf("/* Generated by host/tablegen.c - do not edit */\n\n");
+
+    if (kernels) {
+
+        printf("#include <stddef.h>\n\n");
+
+        printf("#include \"nnkernels.h\"\n\n");
+
+        return writeKernels() ? 0 : EXIT_FAILURE;
+
+    }
+
+    printf("#include \"dsptables.h\"\n\n");
+
+    writeDCTMatrix();
+
+    writeHammingWindowQ15();
+
+    if (!writeFilterbank()) return EXIT_FAILURE;
+
+    writeActivationTables();
+
+    return 0;
+
+}
@@ -0,0 +1,205 @@
+/****************************************************************************
+ * wavfile.c
+ * openacousticdevices.info
+ * October 2026
+ *****************************************************************************/
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "wavfile.h"
+
+/* WAV constants */
+
+#define PCM_FORMAT                              1
+#define RIFF_ID_LENGTH                          4
+#define BITS_PER_SAMPLE                         16
+
+/* Resampling filter constants */
+
+#define RESAMPLING_HALF_WIDTH                   16
+#define PI_DOUBLE                               3.14159265358979323846
+
+/* Little-endian field readers */
+
+static uint32_t readUint32(uint8_t *src) {
+
+    return (uint32_t)src[0] | (uint32_t)src[1] << 8 | (uint32_t)src[2] << 16 | (uint32_t)src[3] << 24;
+
+}
+
+static uint16_t readUint16(uint8_t *src) {
+
+    return (uint16_t)(src[0] | src[1] << 8);
+
+}
+
+/* Windowed-sinc interpolation, low-pass filtered at the lower of the two Nyquist frequencies */
+
+static int16_t *resample(float *source, uint32_t numberOfSourceSamples, uint32_t sourceRate, uint32_t destinationRate, uint32_t *numberOfSamples) {
+
+    uint32_t length = (uint32_t)((uint64_t)numberOfSourceSamples * destinationRate / sourceRate);
+
+    int16_t *destination = malloc(sizeof(int16_t) * (length > 0 ? length : 1));
+
+    if (destination == NULL) return NULL;
+
+    double ratio = (double)sourceRate / destinationRate;
+
+    double cutoff = ratio > 1.0 ? 1.0 / ratio : 1.0;
+
+    for (uint32_t i = 0; i < length; i += 1) {
+
+        double position = i * ratio;
+
+        int32_t centre = (int32_t)floor(position);
+
+        double sum = 0.0;
+
+        for (int32_t j = centre - RESAMPLING_HALF_WIDTH + 1; j <= centre + RESAMPLING_HALF_WIDTH; j += 1) {
+
+            if (j < 0 || j >= (int32_t)numberOfSourceSamples) continue;
+
+            double x = position - j;
+
+            double sinc = x == 0.0 ? 1.0 : sin(PI_DOUBLE * cutoff * x) / (PI_DOUBLE * cutoff * x);
+
+            double window = 0.5 + 0.5 * cos(PI_DOUBLE * x / RESAMPLING_HALF_WIDTH);
+
+            sum += source[j] * cutoff * sinc * window;
+
+        }
+
+        sum = sum > INT16_MAX ? INT16_MAX : sum < INT16_MIN ? INT16_MIN : sum;
+
+        destination[i] = (int16_t)lrint(sum);
+
+    }
+
+    *numberOfSamples = length;
+
+    return destination;
+
+}
+
+bool WavFile_read(const char *filename, uint32_t sampleRate, int16_t **samples, uint32_t *numberOfSamples) {
+
+    FILE *file = fopen(filename, "rb");
+
+    if (file == NULL) return false;
+
+    uint8_t header[3 * RIFF_ID_LENGTH];
+
+    if (fread(header, 1, sizeof(header), file) != sizeof(header) || memcmp(header, "RIFF", RIFF_ID_LENGTH) || memcmp(header + 2 * RIFF_ID_LENGTH, "WAVE", RIFF_ID_LENGTH)) {
+
+        fclose(file);
+
+        return false;
+
+    }
+
+    uint16_t numberOfChannels = 0;
+
+    uint32_t fileSampleRate = 0;
+
+    uint8_t *data = NULL;
+
+    uint32_t dataSize = 0;
+
+    /* Walk the chunks until the format and the data have been found */
+
+    uint8_t chunkHeader[2 * RIFF_ID_LENGTH];
+
+    while (data == NULL && fread(chunkHeader, 1, sizeof(chunkHeader), file) == sizeof(chunkHeader)) {
+
+        uint32_t size = readUint32(chunkHeader + RIFF_ID_LENGTH);
+
+        if (memcmp(chunkHeader, "fmt ", RIFF_ID_LENGTH) == 0) {
+
+            uint8_t format[16];
+
+            if (size < sizeof(format) || fread(format, 1, sizeof(format), file) != sizeof(format)) break;
+
+            if (readUint16(format) != PCM_FORMAT || readUint16(format + 14) != BITS_PER_SAMPLE) break;
+
+            numberOfChannels = readUint16(format + 2);
+
+            fileSampleRate = readUint32(format + 4);
+
+            fseek(file, (size - sizeof(format)) + (size & 1), SEEK_CUR);
+
+        } else if (memcmp(chunkHeader, "data", RIFF_ID_LENGTH) == 0 && numberOfChannels > 0) {
+
+            data = malloc(size > 0 ? size : 1);
+
+            if (data == NULL) break;
+
+            dataSize = (uint32_t)fread(data, 1, size, file);
+
+        } else {
+
+            fseek(file, size + (size & 1), SEEK_CUR);
+
+        }
+
+    }
+
+    fclose(file);
+
+    if (data == NULL) return false;
+
+    /* Mix down to one channel */
+
+    uint32_t numberOfFrames = dataSize / (numberOfChannels * sizeof(int16_t));
+
+    float *mixed = malloc(sizeof(float) * (numberOfFrames > 0 ? numberOfFrames : 1));
+
+    if (mixed == NULL) {
+
+        free(data);
+
+        return false;
+
+    }
+
+    for (uint32_t i = 0; i < numberOfFrames; i += 1) {
+
+        float sum = 0.0f;
+
+        for (uint32_t j = 0; j < numberOfChannels; j += 1) {
+            sum += (int16_t)readUint16(data + 2 * (i * numberOfChannels + j));
+        }
+
+        mixed[i] = sum / numberOfChannels;
+
+    }
+
+    free(data);
+
+    /* Resample to the requested rate */
+
+    if (fileSampleRate == sampleRate) {
+
+        *samples = malloc(sizeof(int16_t) * (numberOfFrames > 0 ? numberOfFrames : 1));
+
+        if (*samples != NULL) {
+
+            for (uint32_t i = 0; i < numberOfFrames; i += 1) (*samples)[i] = (int16_t)lrintf(mixed[i]);
+
+            *numberOfSamples = numberOfFrames;
+
+        }
+
+    } else {
+
+        *samples = resample(mixed, numberOfFrames, fileSampleRate, sampleRate, numberOfSamples);
+
+    }
+
+    free(mixed);
+
+    return *samples != NULL;
+
+}
@@ -0,0 +1,17 @@
+/****************************************************************************
+ * wavfile.h
+ * openacousticdevices.info
+ * October 2026
+ *****************************************************************************/
+
+#ifndef __WAVFILE_H
+#define __WAVFILE_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/* Read a 16-bit PCM WAV file, mixed down to one channel and resampled to the requested rate. The caller frees *samples. */
+
+bool WavFile_read(const char *filename, uint32_t sampleRate, int16_t **samples, uint32_t *numberOfSamples);
+
+#endif /* __WAVFILE_H */
@@ -0,0 +1,142 @@
+/****************************************************************************
+ * detectionlog.h
+ * openacousticdevices.info
+ * October 2026
+ *****************************************************************************/
+
+#ifndef __DETECTIONLOG_H
+#define __DETECTIONLOG_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/* Detection log: the detections of a recording are kept in RAM and written
+ * to calls.txt in one append per superbuffer instead of one per detection.
+ * The log holds two superbuffers of detections (one per frame), and
+ * detections arriving while it is full are counted and dropped.
+ *
+ * With events enabled, the runs of detected frames are merged into events
+ * before they reach the log. A run ends when a different class is detected
+ * or when no frame is detected for longer than the gap tolerance, and an
+ * event shorter than the minimum duration is discarded. Each event records
+ * its start and end (the times of its first and last detected frames), its
+ * class, the number of detected frames and the peak and mean scores of the
+ * class over them. An event longer than DETECTION_LOG_MAXIMUM_DURATION is
+ * split.
+ *
+ * The binary log (calls.bin) stores the entries as they are held in RAM,
+ * 16 little-endian bytes each, without formatting them. The entries of each
+ * recording follow a header with the device serial number, the settings
+ * and the CRCs of the models that produced them. The binary entries are
+ * timed in UTC and the header gives the timezone offset of the device,
+ * while calls.txt is in local time. A header starts with
+ * DETECTION_LOG_MAGIC and gives its own size, so a decoder can skip fields
+ * added by later versions. The records are appended over several writes, so
+ * the header has no record count: a decoder finds the headers by the magic
+ * and checks their version, sizes and flags, which a record whose time
+ * equals the magic cannot match */
+
+#define DETECTION_LOG_SIZE                  32
+
+#define DETECTION_LOG_MAXIMUM_DURATION      (UINT16_MAX * 10)
+
+#define DETECTION_LOG_SCORE_ONE             UINT16_MAX
+
+/* Longest calls.txt line, "2026/10/17 06:12:31.52 0" for a frame and
+ * "2026/10/17 06:12:31.52 0 06:12:33.12 50 0.917 0.781" for an event */
+
+#define DETECTION_LOG_LINE_LENGTH           56
+
+/* Binary log constants */
+
+#define DETECTION_LOG_MAGIC                 0x4C444D41
+
+#define DETECTION_LOG_VERSION               2
+
+#define DETECTION_LOG_SERIAL_NUMBER_SIZE    8
+
+#define DETECTION_LOG_MAXIMUM_NUMBER_OF_CLASSES 8
+
+#define DETECTION_LOG_FLAG_EVENTS           0x0001
+#define DETECTION_LOG_FLAG_CASCADE          0x0002
+
+/* Detection or event: UTC time in seconds and milliseconds, duration in
+ * hundredths of a second and scores in units of 1 / DETECTION_LOG_SCORE_ONE */
+
+typedef struct {
+    uint32_t time;
+    uint16_t milliseconds;
+    uint16_t duration;
+    uint16_t numberOfFrames;
+    uint16_t peakScore;
+    uint16_t meanScore;
+    uint8_t detectedClass;
+    uint8_t reserved;
+} detection_t;
+
+/* Event being built, timed in milliseconds from the start of the recording */
+
+typedef struct {
+    bool active;
+    uint32_t detectedClass;
+    uint32_t start;
+    uint32_t end;
+    uint32_t numberOfFrames;
+    float peakScore;
+    float sumOfScores;
+} detectionEvent_t;
+
+typedef struct {
+    detection_t entries[DETECTION_LOG_SIZE];
+    uint32_t first;
+    uint32_t numberOfEntries;
+    uint32_t numberOfDropped;
+    uint32_t startTime;
+    int32_t timezoneMinutes;
+    bool eventsEnabled;
+    uint32_t maximumGap;
+    uint32_t minimumDuration;
+    uint32_t numberOfDiscardedEvents;
+    detectionEvent_t event;
+} detectionLog_t;
+
+/* Header of the entries of a recording in the binary log: the start time is
+ * the UTC time of the recording and the timezone offset of the device is in
+ * minutes (version 1 headers had no offset and local times), the gap and
+ * the minimum duration of the
+ * events are in milliseconds and the CRCs are those of the model files, zero
+ * for the built-in model or without a confirmer */
+
+typedef struct {
+    uint32_t magic;
+    uint16_t version;
+    uint16_t headerSize;
+    uint16_t recordSize;
+    uint16_t flags;
+    uint8_t serialNumber[DETECTION_LOG_SERIAL_NUMBER_SIZE];
+    uint32_t startTime;
+    uint32_t sampleRate;
+    uint32_t modelCRC;
+    uint32_t confirmerCRC;
+    uint32_t maximumGap;
+    uint32_t minimumDuration;
+    uint16_t numberOfClasses;
+    int16_t timezoneMinutes;
+    float thresholds[DETECTION_LOG_MAXIMUM_NUMBER_OF_CLASSES];
+} detectionLogHeader_t;
+
+void DetectionLog_reset(detectionLog_t *log, uint32_t startTime, int32_t timezoneMinutes);
+
+void DetectionLog_setEvents(detectionLog_t *log, bool eventsEnabled, uint32_t maximumGap, uint32_t minimumDuration);
+
+void DetectionLog_addFrame(detectionLog_t *log, uint32_t milliseconds, int32_t detectedClass, float score);
+
+void DetectionLog_finish(detectionLog_t *log);
+
+uint32_t DetectionLog_format(detectionLog_t *log, char *buffer, uint32_t size);
+
+void DetectionLog_initialiseHeader(const detectionLog_t *log, detectionLogHeader_t *header, const uint8_t *serialNumber, uint32_t sampleRate);
+
+uint32_t DetectionLog_encode(detectionLog_t *log, uint8_t *buffer, uint32_t size);
+
+#endif /* __DETECTIONLOG_H */
@@ -0,0 +1,330 @@
+/****************************************************************************
+ * detector.h
+ * openacousticdevices.info
+ * October 2026
+ *****************************************************************************/
+
+#ifndef __DETECTOR_H
+#define __DETECTOR_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#ifndef __FPU_PRESENT
+#define __FPU_PRESENT                       1    /*!< FPU present */
+#endif
+
+#include "arm_math.h"
+
+/* Feature extraction constants */
+
+#define NUMBER_OF_SAMPLES_IN_FRAME          1024
+#define NUMBER_OF_BINS_IN_FRAME             (NUMBER_OF_SAMPLES_IN_FRAME / 2)
+
+#define NUMBER_OF_BUFFERS_MFCC              5
+#define NUMBER_OF_SAMPLES_IN_BUFFERS_MFCC   12
+#define NUMBER_OF_FEATURES                  (2 * NUMBER_OF_SAMPLES_IN_BUFFERS_MFCC)
+#define NBANKS                              41
+
+#define MAX_INT_VALUE                       32767
+
+/* Mel filterbank design, as melfilterbanks(flow, fhigh, NBANKS, f, fs, 0, n)
+ * in MATLAB/test_one_file.py. The tables are generated from these values by
+ * host/tablegen.c, which reports the number of weights if the bands change */
+
+#define FILTERBANK_SAMPLE_RATE              32000
+#define FILTERBANK_LOW_FREQUENCY            300
+#define FILTERBANK_HIGH_FREQUENCY           (FILTERBANK_SAMPLE_RATE / 2)
+#define FILTERBANK_AREA_NORMALISATION       1
+
+#define NUMBER_OF_FILTERBANK_WEIGHTS        860
+
+/* Neural network constants. The model is loaded at run time (see nnmodel.h)
+ * and these bound the size of the multilayer perceptron it may describe */
+
+#define NN_MAXIMUM_NUMBER_OF_LAYERS         4
+#define NN_MAXIMUM_LAYER_WIDTH              64
+
+/* Temporal layers: a causal dilated convolution over the inputs of the last
+ * frames. Each one keeps the inputs it still needs in a ring of
+ * (numberOfTaps - 1) * dilation + 1 frames, taken from a shared state of
+ * NN_TEMPORAL_STATE_SIZE values, so each frame only computes its own column */
+
+#define NN_MAXIMUM_NUMBER_OF_TAPS           8
+#define NN_TEMPORAL_STATE_SIZE              512
+
+/* The outputs of the last layer are the class probabilities, each compared
+ * with its own threshold. NN_NO_DETECTION is returned when none exceeds it */
+
+#define NN_MAXIMUM_NUMBER_OF_CLASSES        8
+#define NN_NO_DETECTION                     -1
+
+/* Cascade: a second, larger model (the confirmer) runs only on the frames
+ * where the per-frame model (the gate) exceeds a lower pre-threshold. Its
+ * input is the MFCCs, without deltas, of the last NN_CONFIRMER_NUMBER_OF_FRAMES
+ * frames (about one second) averaged over steps of NN_CONFIRMER_FRAMES_PER_STEP
+ * frames, oldest step first */
+
+#define NN_CONFIRMER_NUMBER_OF_FRAMES       32
+#define NN_CONFIRMER_FRAMES_PER_STEP        4
+#define NN_CONFIRMER_NUMBER_OF_STEPS        (NN_CONFIRMER_NUMBER_OF_FRAMES / NN_CONFIRMER_FRAMES_PER_STEP)
+#define NN_CONFIRMER_NUMBER_OF_FEATURES     (NN_CONFIRMER_NUMBER_OF_STEPS * NUMBER_OF_SAMPLES_IN_BUFFERS_MFCC)
+
+#define NN_MAXIMUM_NUMBER_OF_INPUTS         NN_CONFIRMER_NUMBER_OF_FEATURES
+
+/* Shapes ({inputs, outputs}) of the float32 layers that get a fully unrolled
+ * kernel generated by host/tablegen.c, by default those of the built-in model.
+ * Set them to the layers of the deployed model (export_model.py prints them);
+ * layers of any other shape use the generic matrix kernel */
+
+#define NN_KERNEL_SHAPES                    {{NUMBER_OF_FEATURES, 2}, {2, 2}}
+
+/* Activation tables of the int8 network, generated by host/tablegen.c. The
+ * tansig table holds tansig(x) in Q7 for x in [-128, 127] steps and the
+ * softmax table exp(-x) scaled to 65535 for x in [0, 255] steps */
+
+#define NN_ACTIVATION_TABLE_SIZE            256
+#define NN_TANSIG_TABLE_STEP                0.03125f
+#define NN_SOFTMAX_TABLE_STEP               0.03125f
+
+/* Energy gate: buffers whose mean square is below an adaptive noise floor
+ * times a margin skip the feature extraction and the neural network. The
+ * floor follows falling energy quickly and rising energy slowly (shifts of
+ * the difference per frame). It keeps ENERGY_GATE_FLOOR_FRACTION_BITS
+ * fractional bits, so that it still follows a background only a few units
+ * of mean square from it. The gate stays open for a hangover of
+ * frames after the energy drops so that the centre frame of the deltas,
+ * two frames behind, and the tail of a call are still classified. Margins
+ * are clamped to ENERGY_GATE_MAXIMUM_MARGIN_DB, far above any call, so that
+ * they fit in 32 bits */
+
+#define ENERGY_GATE_FALL_SHIFT              3
+#define ENERGY_GATE_RISE_SHIFT              8
+#define ENERGY_GATE_HANGOVER_FRAMES         8
+#define ENERGY_GATE_MARGIN_ONE              256
+#define ENERGY_GATE_FLOOR_FRACTION_BITS     8
+#define ENERGY_GATE_MAXIMUM_MARGIN_DB       60.0f
+
+/* Float activation table, used instead of exp when DETECTOR_TABLE_ACTIVATIONS
+ * is defined: tanh(x) for x in [0, NN_TANH_TABLE_RANGE] in NN_TANH_TABLE_SIZE
+ * steps, linearly interpolated and saturated to 1 beyond the range. Tansig is
+ * tanh, and a 2-way softmax is the sigmoid of the logit difference, itself
+ * (1 + tanh(difference / 2)) / 2. The interpolation error falls with the
+ * square of the step, about 1e-4 for 256 steps and 6e-6 for 1024 */
+
+#define NN_TANH_TABLE_SIZE                  256
+#define NN_TANH_TABLE_RANGE                 8.0f
+
+/* Upper bound on the detector arena on the device, checked at compile time.
+ * The Q31 front end, with its 2N-word FFT output, is the largest build: about
+ * 17.7 KB with the temporal state, against 13.5 KB in single precision */
+
+#define DETECTOR_ARENA_MAXIMUM_SIZE         18432
+
+/* Front end number format. The window, FFT, magnitude and filterbank stages
+ * run in single precision unless DETECTOR_FIXED_POINT is set to 31 (Q31), in
+ * which case the energies are converted to float at the log. There is no Q15
+ * front end: the 1/N scaling of a 1024-point Q15 transform leaves too few
+ * bits of the spectrum for the model */
+
+#ifndef DETECTOR_FIXED_POINT
+
+typedef float32_t frontEnd_t;
+typedef arm_rfft_fast_instance_f32 frontEndFFTInstance_t;
+
+#define NUMBER_OF_FFT_OUTPUTS               NUMBER_OF_SAMPLES_IN_FRAME
+
+#elif DETECTOR_FIXED_POINT == 31
+
+typedef q31_t frontEnd_t;
+typedef arm_rfft_instance_q31 frontEndFFTInstance_t;
+
+#define NUMBER_OF_FFT_OUTPUTS               (2 * NUMBER_OF_SAMPLES_IN_FRAME)
+
+#else
+
+#error "DETECTOR_FIXED_POINT must be 31"
+
+#endif
+
+/* Feature extractor context, initialised once and reused for every frame */
+
+typedef struct {
+    frontEndFFTInstance_t realFFTinstance;
+    const uint16_t *bankStarts;
+    const uint16_t *bankOffsets;
+    const frontEnd_t *bankWeights;
+#ifndef DETECTOR_FIXED_POINT
+    const float32_t *window;
+#else
+    const q15_t *window;
+    float32_t bankScales[NBANKS - 1];
+#endif
+    arm_matrix_instance_f32 dctMatrix;
+    frontEnd_t frame[NUMBER_OF_SAMPLES_IN_FRAME];
+    frontEnd_t cplxFFT[NUMBER_OF_FFT_OUTPUTS];
+    float32_t energies[NBANKS - 1];
+} featureExtractor_t;
+
+void Detector_initialiseFeatureExtractor(featureExtractor_t *extractor);
+
+/* Feature extraction stages (applied in this order by Detector_MFCC) */
+
+void Detector_applyWindow(featureExtractor_t *extractor, int16_t *bufferIN, frontEnd_t *windowed);
+
+void Detector_FFT(featureExtractor_t *extractor, frontEnd_t *windowed, frontEnd_t *cplxFFT);
+
+void Detector_magnitude(frontEnd_t *cplxFFT, frontEnd_t *spectrum);
+
+void Detector_melFilterbank(featureExtractor_t *extractor, frontEnd_t *spectrum, float32_t *energies);
+
+void Detector_logEnergies(float32_t *energies, float32_t *logEnergies);
+
+void Detector_DCTII(featureExtractor_t *extractor, float32_t *indct, float32_t *outdct);
+
+/* MFCC history: a ring of the last NUMBER_OF_BUFFERS_MFCC frames indexed by
+ * the slot of the newest one. Each slot holds the MFCCs of its frame followed
+ * by the deltas, filled in once the frame is the centre of the delta window,
+ * so the slot is the neural network input without any copying */
+
+typedef struct {
+    float32_t slots[NUMBER_OF_BUFFERS_MFCC][NUMBER_OF_FEATURES];
+    uint32_t head;
+} mfccHistory_t;
+
+void Detector_resetHistory(mfccHistory_t *history);
+
+float32_t* Detector_advanceHistory(mfccHistory_t *history);
+
+/* Energy gate state, reset with the arena. The noise floor is a mean square
+ * with ENERGY_GATE_FLOOR_FRACTION_BITS fractional bits, and the margin is a
+ * power ratio in units of 1 / ENERGY_GATE_MARGIN_ONE */
+
+typedef struct {
+    uint64_t noiseFloor;
+    uint32_t hangover;
+} energyGate_t;
+
+uint32_t Detector_frameEnergy(const int16_t *bufferIN);
+
+bool Detector_applyEnergyGate(energyGate_t *gate, uint32_t energy, uint32_t margin);
+
+/* MFCC window of the confirmer: a ring of the MFCCs of the last
+ * NN_CONFIRMER_NUMBER_OF_FRAMES frames, reduced to the confirmer input only
+ * when the confirmer runs */
+
+typedef struct {
+    float32_t frames[NN_CONFIRMER_NUMBER_OF_FRAMES][NUMBER_OF_SAMPLES_IN_BUFFERS_MFCC];
+    float32_t features[NN_CONFIRMER_NUMBER_OF_FEATURES];
+    uint32_t head;
+    uint32_t numberOfFrames;
+} mfccWindow_t;
+
+void Detector_resetWindow(mfccWindow_t *window);
+
+void Detector_updateWindow(mfccWindow_t *window, const mfccHistory_t *history);
+
+float32_t* Detector_windowFeatures(mfccWindow_t *window);
+
+/* Neural network model: a multilayer perceptron whose fully connected layers
+ * compute activation(weights * input + biases), with the weights of each layer
+ * stored row major (one row of numberOfInputs weights per output) */
+
+typedef enum {NN_LINEAR, NN_TANSIG, NN_SOFTMAX, NUMBER_OF_NN_ACTIVATIONS} nnActivation_t;
+
+/* The int8 encoding holds int8 weights and int32 biases with a scale per
+ * layer. Each accumulator is requantised by (accumulator * multiplier) >>
+ * shift into the units of the next layer's inputs or of the activation table */
+
+typedef enum {NN_FLOAT32, NN_INT8, NUMBER_OF_NN_ENCODINGS} nnEncoding_t;
+
+/* A layer with more than one tap is temporal: its weights are one block of
+ * numberOfOutputs x numberOfInputs per tap, tap 0 applied to the input of the
+ * current frame and tap k to the input of dilation * k frames before */
+
+/* Unrolled kernel of a float32 layer: output = weights * input + biases */
+
+typedef void (*nnKernel_t)(const float32_t *weights, const float32_t *biases, const float32_t *input, float32_t *output);
+
+typedef struct {
+    uint16_t numberOfInputs;
+    uint16_t numberOfOutputs;
+    nnActivation_t activation;
+    uint16_t numberOfTaps;
+    uint16_t dilation;
+    uint16_t stateOffset;
+    uint16_t numberOfStateFrames;
+    const float32_t *weights;
+    const float32_t *biases;
+    nnKernel_t kernel;
+    const q7_t *quantisedWeights;
+    const int32_t *quantisedBiases;
+    int32_t multiplier;
+    int32_t shift;
+    float32_t accumulatorScale;
+} nnLayer_t;
+
+typedef struct {
+    uint32_t numberOfLayers;
+    uint32_t numberOfClasses;
+    uint32_t crc;
+    nnEncoding_t encoding;
+    float32_t inputInverseScale;
+    uint32_t temporalStateSize;
+    nnLayer_t layers[NN_MAXIMUM_NUMBER_OF_LAYERS];
+} nnModel_t;
+
+/* Neural network scratch: the activations of consecutive layers alternate
+ * between two buffers. The state of the temporal layers persists from frame
+ * to frame and is cleared with the arena at the start of each recording */
+
+typedef struct {
+    float32_t activations[2][NN_MAXIMUM_LAYER_WIDTH];
+    float32_t temporalState[NN_TEMPORAL_STATE_SIZE];
+    uint32_t numberOfFrames;
+    q7_t quantisedInputs[NN_MAXIMUM_NUMBER_OF_INPUTS];
+    q7_t quantisedActivations[2][NN_MAXIMUM_LAYER_WIDTH];
+    int32_t accumulators[NN_MAXIMUM_LAYER_WIDTH];
+} neuralNetwork_t;
+
+/* Batch scratch: the activations of a batch of frames, one column per frame,
+ * for throughput-oriented callers such as the host tools. It is not part of
+ * the arena, as the device runs the network frame by frame */
+
+#define NN_MAXIMUM_BATCH_SIZE               16
+
+typedef struct {
+    float32_t activations[2][NN_MAXIMUM_LAYER_WIDTH * NN_MAXIMUM_BATCH_SIZE];
+    float32_t column[NN_MAXIMUM_NUMBER_OF_INPUTS];
+} neuralNetworkBatch_t;
+
+/* Detector arena: all the state of the detector, statically allocated by the
+ * caller and reset at the start of each recording instead of allocated */
+
+typedef struct {
+    featureExtractor_t featureExtractor;
+    mfccHistory_t mfccHistory;
+    mfccWindow_t mfccWindow;
+    neuralNetwork_t neuralNetwork;
+    energyGate_t energyGate;
+} detectorArena_t;
+
+void Detector_resetArena(detectorArena_t *arena);
+
+/* Feature extraction functions */
+
+void Detector_MFCC(featureExtractor_t *extractor, int16_t *bufferIN, float32_t *bufferOUT);
+
+float32_t* Detector_deltas(mfccHistory_t *history);
+
+/* Classification functions */
+
+const float32_t* Detector_neuralNetwork(neuralNetwork_t *network, const nnModel_t *model, float32_t *bufferMFCC);
+
+const float32_t* Detector_neuralNetworkBatch(neuralNetworkBatch_t *batch, neuralNetwork_t *network, const nnModel_t *model, const float32_t *features, uint32_t numberOfFrames);
+
+int32_t Detector_classify(const float32_t *probabilities, const float32_t *thresholds, uint32_t numberOfClasses);
+
+int32_t Detector_confirm(neuralNetwork_t *network, const nnModel_t *confirmer, mfccWindow_t *window, const float32_t *thresholds, float32_t *score);
+
+#endif /* __DETECTOR_H */
@@ -0,0 +1,34 @@
+/****************************************************************************
+ * dsptables.h
+ * openacousticdevices.info
+ * October 2026
+ *****************************************************************************/
+
+#ifndef __DSPTABLES_H
+#define __DSPTABLES_H
+
+#include "detector.h"
+
+/* Constant DSP tables generated by host/tablegen.c into src/dsptables.c */
+
+extern const float32_t DSPTables_dctMatrix[NUMBER_OF_SAMPLES_IN_BUFFERS_MFCC * (NBANKS - 1)];
+
+extern const q15_t DSPTables_hammingWindowQ15[NUMBER_OF_SAMPLES_IN_FRAME];
+
+extern const uint16_t DSPTables_filterbankStarts[NBANKS - 1];
+
+extern const uint16_t DSPTables_filterbankOffsets[NBANKS];
+
+extern const float32_t DSPTables_filterbankWeights[NUMBER_OF_FILTERBANK_WEIGHTS];
+
+extern const float32_t DSPTables_filterbankMaxima[NBANKS - 1];
+
+extern const q31_t DSPTables_filterbankWeightsQ31[NUMBER_OF_FILTERBANK_WEIGHTS];
+
+extern const q7_t DSPTables_tansigQ7[NN_ACTIVATION_TABLE_SIZE];
+
+extern const uint16_t DSPTables_softmaxExponential[NN_ACTIVATION_TABLE_SIZE];
+
+extern const float32_t DSPTables_tanh[NN_TANH_TABLE_SIZE + 1];
+
+#endif /* __DSPTABLES_H */
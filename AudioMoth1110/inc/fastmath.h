@@ -0,0 +1,38 @@
+/****************************************************************************
+ * fastmath.h
+ * openacousticdevices.info
+ * October 2026
+ *****************************************************************************/
+
+#ifndef __FASTMATH_H
+#define __FASTMATH_H
+
+#include <stdint.h>
+
+#include "detector.h"
+
+/* Single-precision approximations that avoid the double-precision library
+ * routines, which are emulated in software on the Cortex-M4F.
+ *
+ * FastMath_log10f: |error| < 1e-7 absolute for results in [-1, 1] and
+ *                  < 1e-7 relative elsewhere, for all positive normal and
+ *                  subnormal inputs. Returns -inf for 0 and NaN for x < 0.
+ *
+ * FastMath_expf:   relative error < 2.5e-7 (about 2 ulp) for x in
+ *                  [-87.33, 88.72]. Returns +inf above and 0 below.
+ *
+ * Both bounds are checked over the input range by 'make mathcheck' in the
+ * host folder.
+ */
+
+float32_t FastMath_log10f(float32_t x);
+
+float32_t FastMath_expf(float32_t x);
+
+/* Vector versions, unrolled by four (source and destination may be the same array) */
+
+void FastMath_vlog10_f32(const float32_t *pSrc, float32_t *pDst, uint32_t blockSize);
+
+void FastMath_vexp_f32(const float32_t *pSrc, float32_t *pDst, uint32_t blockSize);
+
+#endif /* __FASTMATH_H */
@@ -0,0 +1,17 @@
+/****************************************************************************
+ * nnkernels.h
+ * openacousticdevices.info
+ * October 2026
+ *****************************************************************************/
+
+#ifndef __NNKERNELS_H
+#define __NNKERNELS_H
+
+#include "detector.h"
+
+/* Fully connected layer kernels generated by host/tablegen.c into src/nnkernels.c
+ * for the NN_KERNEL_SHAPES of detector.h. Returns NULL for any other shape */
+
+nnKernel_t NNKernels_find(uint32_t numberOfInputs, uint32_t numberOfOutputs);
+
+#endif /* __NNKERNELS_H */
@@ -0,0 +1,96 @@
+/****************************************************************************
+ * nnmodel.h
+ * openacousticdevices.info
+ * October 2026
+ *****************************************************************************/
+
+#ifndef __NNMODEL_H
+#define __NNMODEL_H
+
+#include <stdint.h>
+
+#include "detector.h"
+
+/* Binary model file, read once from the SD card into RAM so that a new model
+ * does not need a firmware rebuild. All fields are little endian:
+ *
+ *   header        16 bytes, nnModelHeader_t
+ *   layers        for each layer an nnModelLayerHeader_t followed by
+ *                 float32 encoding: the float32 weights (outputs x inputs,
+ *                 row major, one block per tap) and biases
+ *                 int8 encoding: an nnModelQuantisation_t, the int32 biases
+ *                 and the int8 weights, padded to a multiple of 4 bytes
+ *   CRC           CRC-32 (as zlib.crc32) of the header and the layers
+ *
+ * The outputs of the last layer are the classes, at most
+ * NN_MAXIMUM_NUMBER_OF_CLASSES, with class 0 the first output.
+ *
+ * In the int8 encoding a layer input x is stored as x / inputScale, a weight
+ * w as w / weightScale and a bias b as b / (inputScale * weightScale). Tansig
+ * layers output Q7 values, so the inputScale of the next layer must be 1/128,
+ * and linear layers output int8 values in units of their outputScale, which
+ * must be the inputScale of the next layer. Files with other scales, or with
+ * an inputScale or weightScale that is not positive, are rejected. Softmax is
+ * only supported in the last layer.
+ *
+ * Version 2 adds temporal layers, whose header gives the number of taps and
+ * the dilation (see detector.h). They are float32 only. A version 1 file holds
+ * dense layers only and is still accepted, but a layer whose reserved bytes,
+ * where version 2 keeps the taps and the dilation, are not zero is rejected.
+ *
+ * MATLAB/export_model.py writes this file from NeuralNetworkFunction.m, and
+ * MATLAB/quantize_model.py writes the int8 encoding. */
+
+#define NN_MODEL_FILENAME                   "NN_MODEL.bin"
+#define NN_CONFIRMER_FILENAME               "NN_CONFIRM.bin"
+
+#define NN_MODEL_MAGIC                      0x4E4E4D41
+#define NN_MODEL_VERSION                    2
+#define NN_MODEL_TEMPORAL_VERSION           2
+
+#define NN_MODEL_MAXIMUM_SIZE               4096
+
+#pragma pack(push, 1)
+
+typedef struct {
+    uint32_t magic;
+    uint16_t version;
+    uint16_t numberOfLayers;
+    uint16_t numberOfInputs;
+    uint16_t encoding;
+    uint32_t layersSize;
+} nnModelHeader_t;
+
+typedef struct {
+    uint16_t numberOfInputs;
+    uint16_t numberOfOutputs;
+    uint8_t activation;
+    uint8_t numberOfTaps;
+    uint8_t dilation;
+    uint8_t reserved;
+} nnModelLayerHeader_t;
+
+typedef struct {
+    float32_t inputScale;
+    float32_t weightScale;
+    float32_t outputScale;
+} nnModelQuantisation_t;
+
+#pragma pack(pop)
+
+typedef enum {NN_MODEL_OK, NN_MODEL_WRONG_SIZE, NN_MODEL_WRONG_MAGIC, NN_MODEL_WRONG_VERSION, NN_MODEL_WRONG_CRC, NN_MODEL_WRONG_SHAPE, NN_MODEL_MISSING, NUMBER_OF_NN_MODEL_STATUSES} nnModelStatus_t;
+
+/* Check a model image and point the layers of the model into it. The image
+ * must stay in memory while the model is used. */
+
+nnModelStatus_t NNModel_parse(nnModel_t *model, const uint32_t *image, uint32_t size, uint32_t numberOfInputs);
+
+/* Model compiled into the firmware, used when no valid model file is present */
+
+void NNModel_loadDefault(nnModel_t *model);
+
+const char* NNModel_describeStatus(nnModelStatus_t status);
+
+uint32_t NNModel_crc32(const uint8_t *data, uint32_t size);
+
+#endif /* __NNMODEL_H */
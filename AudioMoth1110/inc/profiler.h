@@ -0,0 +1,77 @@
+/****************************************************************************
+ * profiler.h
+ * openacousticdevices.info
+ * October 2026
+ *****************************************************************************/
+
+#ifndef __PROFILER_H
+#define __PROFILER_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/* Stages of the per-buffer pipeline in makeRecording */
+
+typedef enum {PROFILE_WINDOW, PROFILE_FFT, PROFILE_MAGNITUDE, PROFILE_FILTERBANK, PROFILE_LOG10, PROFILE_DCT, PROFILE_DELTAS, PROFILE_NEURAL_NETWORK, PROFILE_CONFIRMER, PROFILE_WRITE, NUMBER_OF_PROFILE_STAGES} profileStage_t;
+
+/* Timing source: DWT cycle counter on the device, monotonic clock in nanoseconds on the host */
+
+#if defined(__arm__)
+
+#include "em_device.h"
+
+#define PROFILER_UNITS                      "cycles"
+
+static inline uint32_t Profiler_getTicks(void) {
+
+    return DWT->CYCCNT;
+
+}
+
+#else
+
+#include <time.h>
+
+#define PROFILER_UNITS                      "ns"
+
+static inline uint32_t Profiler_getTicks(void) {
+
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return (uint32_t)((uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec);
+
+}
+
+#endif
+
+/* Profiling functions */
+
+void Profiler_reset(void);
+
+void Profiler_record(profileStage_t stage, uint32_t ticks);
+
+uint32_t Profiler_formatReport(char *buffer, uint32_t size);
+
+/* Instrumentation macros, compiled out unless ENABLE_PROFILING is defined */
+
+#ifdef ENABLE_PROFILING
+
+#define PROFILE_RESET()                     Profiler_reset()
+
+#define PROFILE_START(stage)                uint32_t profileStart_##stage = Profiler_getTicks()
+
+#define PROFILE_STOP(stage)                 Profiler_record(stage, Profiler_getTicks() - profileStart_##stage)
+
+#else
+
+#define PROFILE_RESET()
+
+#define PROFILE_START(stage)
+
+#define PROFILE_STOP(stage)
+
+#endif
+
+#endif /* __PROFILER_H */
@@ -0,0 +1,370 @@
+/****************************************************************************
+ * detectionlog.c
+ * openacousticdevices.info
+ * October 2026
+ *****************************************************************************/
+
+#include <time.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "detectionlog.h"
+
+/* Time constants */
+
+#define SECONDS_IN_MINUTE                   60
+#define MILLISECONDS_IN_SECOND              1000
+#define MILLISECONDS_IN_HUNDREDTH           10
+#define HUNDREDTHS_IN_SECOND                100
+
+/* Useful macros */
+
+#define MIN(a, b)                           ((a) < (b) ? (a) : (b))
+
+/* Private functions */
+
+static uint16_t encodeScore(float score) {
+
+    if (score <= 0.0f) return 0;
+
+    if (score >= 1.0f) return DETECTION_LOG_SCORE_ONE;
+
+    return (uint16_t)(score * DETECTION_LOG_SCORE_ONE + 0.5f);
+
+}
+
+static void addEntry(detectionLog_t *log, uint32_t start, uint32_t end, uint32_t detectedClass, uint32_t numberOfFrames, float peakScore, float meanScore) {
+
+    if (log->numberOfEntries == DETECTION_LOG_SIZE) {
+
+        log->numberOfDropped += 1;
+
+        return;
+
+    }
+
+    detection_t *entry = &log->entries[(log->first + log->numberOfEntries) % DETECTION_LOG_SIZE];
+
+    entry->time = log->startTime + start / MILLISECONDS_IN_SECOND;
+
+    entry->milliseconds = start % MILLISECONDS_IN_SECOND;
+
+    entry->duration = (end - start) / MILLISECONDS_IN_HUNDREDTH;
+
+    entry->numberOfFrames = MIN(numberOfFrames, UINT16_MAX);
+
+    entry->peakScore = encodeScore(peakScore);
+
+    entry->meanScore = encodeScore(meanScore);
+
+    entry->detectedClass = detectedClass;
+
+    entry->reserved = 0;
+
+    log->numberOfEntries += 1;
+
+}
+
+static void closeEvent(detectionLog_t *log) {
+
+    detectionEvent_t *event = &log->event;
+
+    if (event->active == false) return;
+
+    if (event->end - event->start >= log->minimumDuration) {
+
+        addEntry(log, event->start, event->end, event->detectedClass, event->numberOfFrames, event->peakScore, event->sumOfScores / event->numberOfFrames);
+
+    } else {
+
+        log->numberOfDiscardedEvents += 1;
+
+    }
+
+    event->active = false;
+
+}
+
+static uint32_t formatScore(char *buffer, uint16_t score) {
+
+    uint32_t thousandths = ((uint32_t)score * 1000 + DETECTION_LOG_SCORE_ONE / 2) / DETECTION_LOG_SCORE_ONE;
+
+    return sprintf(buffer, " %u.%03u", (unsigned int)(thousandths / 1000), (unsigned int)(thousandths % 1000));
+
+}
+
+/* 
+ * Function: DetectionLog_reset
+ * Purpose: Empty the detection log at the start of a recording, keeping the
+ *          event settings.
+ * 
+ * Parameters:
+ *  - log: Pointer to the detection log.
+ *  - startTime: UTC time of the start of the recording in seconds.
+ *  - timezoneMinutes: Offset of the local time of calls.txt from UTC.
+ */
+void DetectionLog_reset(detectionLog_t *log, uint32_t startTime, int32_t timezoneMinutes) {
+
+    log->first = 0;
+
+    log->numberOfEntries = 0;
+
+    log->numberOfDropped = 0;
+
+    log->numberOfDiscardedEvents = 0;
+
+    log->startTime = startTime;
+
+    log->timezoneMinutes = timezoneMinutes;
+
+    memset(&log->event, 0, sizeof(detectionEvent_t));
+
+}
+
+/* 
+ * Function: DetectionLog_setEvents
+ * Purpose: Choose between logging each detected frame and logging events.
+ * 
+ * Parameters:
+ *  - log: Pointer to the detection log.
+ *  - eventsEnabled: Merge the detected frames into events.
+ *  - maximumGap: Longest time without a detected frame inside an event, in
+ *    milliseconds.
+ *  - minimumDuration: Shortest event kept, from its first to its last
+ *    detected frame, in milliseconds.
+ */
+void DetectionLog_setEvents(detectionLog_t *log, bool eventsEnabled, uint32_t maximumGap, uint32_t minimumDuration) {
+
+    log->eventsEnabled = eventsEnabled;
+
+    log->maximumGap = maximumGap;
+
+    log->minimumDuration = minimumDuration;
+
+}
+
+/* 
+ * Function: DetectionLog_addFrame
+ * Purpose: Add the result of a frame to the log, called for every frame so
+ *          that the gaps of the events can be measured.
+ * 
+ * Steps:
+ * 1. Without events, add a detected frame as an entry of its own.
+ * 2. Close the current event if the gap since its last detected frame is
+ *    too long, if another class is detected or if it would be too long.
+ * 3. Start an event or extend the current one with a detected frame.
+ * 
+ * Parameters:
+ *  - log: Pointer to the detection log.
+ *  - milliseconds: Time of the frame from the start of the recording.
+ *  - detectedClass: Class detected in the frame, negative if none.
+ *  - score: Score of the detected class.
+ */
+void DetectionLog_addFrame(detectionLog_t *log, uint32_t milliseconds, int32_t detectedClass, float score) {
+
+    if (log->eventsEnabled == false) {
+
+        if (detectedClass >= 0) addEntry(log, milliseconds, milliseconds, detectedClass, 1, score, score);
+
+        return;
+
+    }
+
+    detectionEvent_t *event = &log->event;
+
+    if (event->active) {
+
+        bool gapTooLong = milliseconds - event->end > log->maximumGap;
+
+        bool classChanged = detectedClass >= 0 && (uint32_t)detectedClass != event->detectedClass;
+
+        bool durationTooLong = detectedClass >= 0 && milliseconds - event->start > DETECTION_LOG_MAXIMUM_DURATION;
+
+        if (gapTooLong || classChanged || durationTooLong) closeEvent(log);
+
+    }
+
+    if (detectedClass < 0) return;
+
+    if (event->active == false) {
+
+        event->active = true;
+
+        event->detectedClass = detectedClass;
+
+        event->start = milliseconds;
+
+        event->numberOfFrames = 0;
+
+        event->peakScore = 0.0f;
+
+        event->sumOfScores = 0.0f;
+
+    }
+
+    event->end = milliseconds;
+
+    event->numberOfFrames += 1;
+
+    if (score > event->peakScore) event->peakScore = score;
+
+    event->sumOfScores += score;
+
+}
+
+/* 
+ * Function: DetectionLog_finish
+ * Purpose: Close the current event at the end of a recording.
+ * 
+ * Parameters:
+ *  - log: Pointer to the detection log.
+ */
+void DetectionLog_finish(detectionLog_t *log) {
+
+    closeEvent(log);
+
+}
+
+/* 
+ * Function: DetectionLog_format
+ * Purpose: Format the oldest entries as calls.txt lines and remove them
+ *          from the log.
+ * 
+ * Steps:
+ * 1. While a whole line fits in the buffer, format the oldest entry as its
+ *    local date and time to the hundredth of a second and its class.
+ * 2. For an event, add the time of its end, the number of detected frames
+ *    and the peak and mean scores.
+ * 3. Remove the formatted entries.
+ * 
+ * Parameters:
+ *  - log: Pointer to the detection log.
+ *  - buffer: Buffer for the text, not terminated.
+ *  - size: Size of the buffer in bytes.
+ * 
+ * Returns:
+ *  - Number of bytes written, zero once the log is empty.
+ */
+uint32_t DetectionLog_format(detectionLog_t *log, char *buffer, uint32_t size) {
+
+    uint32_t length = 0;
+
+    char line[DETECTION_LOG_LINE_LENGTH + 1];
+
+    while (log->numberOfEntries > 0 && length + DETECTION_LOG_LINE_LENGTH <= size) {
+
+        detection_t *entry = &log->entries[log->first];
+
+        struct tm time;
+
+        time_t rawTime = (time_t)entry->time + log->timezoneMinutes * SECONDS_IN_MINUTE;
+
+        gmtime_r(&rawTime, &time);
+
+        uint32_t lineLength = sprintf(line, "%04d/%02d/%02d %02d:%02d:%02d.%02u %u", 1900 + time.tm_year, time.tm_mon + 1, time.tm_mday, time.tm_hour, time.tm_min, time.tm_sec, entry->milliseconds / MILLISECONDS_IN_HUNDREDTH, entry->detectedClass);
+
+        if (log->eventsEnabled) {
+
+            uint32_t end = entry->milliseconds / MILLISECONDS_IN_HUNDREDTH + entry->duration;
+
+            rawTime = (time_t)entry->time + log->timezoneMinutes * SECONDS_IN_MINUTE + end / HUNDREDTHS_IN_SECOND;
+
+            gmtime_r(&rawTime, &time);
+
+            lineLength += sprintf(line + lineLength, " %02d:%02d:%02d.%02u %u", time.tm_hour, time.tm_min, time.tm_sec, (unsigned int)(end % HUNDREDTHS_IN_SECOND), entry->numberOfFrames);
+
+            lineLength += formatScore(line + lineLength, entry->peakScore);
+
+            lineLength += formatScore(line + lineLength, entry->meanScore);
+
+        }
+
+        line[lineLength++] = '\n';
+
+        memcpy(buffer + length, line, lineLength);
+
+        length += lineLength;
+
+        log->first = (log->first + 1) % DETECTION_LOG_SIZE;
+
+        log->numberOfEntries -= 1;
+
+    }
+
+    return length;
+
+}
+
+/* 
+ * Function: DetectionLog_initialiseHeader
+ * Purpose: Fill the binary log header of a recording with the format, the
+ *          device and the event settings of the log. The model CRCs, the
+ *          thresholds and the cascade flag are left for the caller.
+ * 
+ * Parameters:
+ *  - log: Pointer to the detection log, reset for the recording.
+ *  - header: Pointer to the header.
+ *  - serialNumber: The DETECTION_LOG_SERIAL_NUMBER_SIZE bytes of the device
+ *    serial number.
+ *  - sampleRate: Sample rate of the recording in Hz.
+ */
+void DetectionLog_initialiseHeader(const detectionLog_t *log, detectionLogHeader_t *header, const uint8_t *serialNumber, uint32_t sampleRate) {
+
+    memset(header, 0, sizeof(detectionLogHeader_t));
+
+    header->magic = DETECTION_LOG_MAGIC;
+
+    header->version = DETECTION_LOG_VERSION;
+
+    header->headerSize = sizeof(detectionLogHeader_t);
+
+    header->recordSize = sizeof(detection_t);
+
+    header->flags = log->eventsEnabled ? DETECTION_LOG_FLAG_EVENTS : 0;
+
+    memcpy(header->serialNumber, serialNumber, DETECTION_LOG_SERIAL_NUMBER_SIZE);
+
+    header->startTime = log->startTime;
+
+    header->timezoneMinutes = log->timezoneMinutes;
+
+    header->sampleRate = sampleRate;
+
+    header->maximumGap = log->eventsEnabled ? log->maximumGap : 0;
+
+    header->minimumDuration = log->eventsEnabled ? log->minimumDuration : 0;
+
+}
+
+/* 
+ * Function: DetectionLog_encode
+ * Purpose: Copy the oldest entries to a buffer as binary log records and
+ *          remove them from the log.
+ * 
+ * Parameters:
+ *  - log: Pointer to the detection log.
+ *  - buffer: Buffer for the records.
+ *  - size: Size of the buffer in bytes.
+ * 
+ * Returns:
+ *  - Number of bytes written, zero once the log is empty.
+ */
+uint32_t DetectionLog_encode(detectionLog_t *log, uint8_t *buffer, uint32_t size) {
+
+    uint32_t length = 0;
+
+    while (log->numberOfEntries > 0 && length + sizeof(detection_t) <= size) {
+
+        memcpy(buffer + length, &log->entries[log->first], sizeof(detection_t));
+
+        length += sizeof(detection_t);
+
+        log->first = (log->first + 1) % DETECTION_LOG_SIZE;
+
+        log->numberOfEntries -= 1;
+
+    }
+
+    return length;
+
+}
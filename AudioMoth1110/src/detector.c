@@ -0,0 +1,1077 @@
+/****************************************************************************
+ * detector.c
+ * openacousticdevices.info
+ * October 2026
+ *****************************************************************************/
+
+#include <math.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "detector.h"
+#include "dsptables.h"
+#include "fastmath.h"
+#include "profiler.h"
+
+/* Single-precision approximations are used for log10 and exp unless DETECTOR_EXACT_MATH is defined */
+
+#ifdef DETECTOR_EXACT_MATH
+#define DETECTOR_EXP(x)                     exp(x)
+#else
+#define DETECTOR_EXP(x)                     FastMath_expf(x)
+#endif
+
+/* The float network activations use the interpolated tanh table if DETECTOR_TABLE_ACTIVATIONS is defined */
+
+#define TANH_TABLE_SCALE                    ((float32_t)NN_TANH_TABLE_SIZE / NN_TANH_TABLE_RANGE)
+
+/* Fixed-point front end. The FFT output is the DFT divided by the frame length and the magnitudes are halved,
+ * so the filterbank energies are scaled back to the units of the float front end when converted to float. The
+ * weights are relative to the band maximum, and the Q31 dot product drops 14 bits of each product */
+
+#ifdef DETECTOR_FIXED_POINT
+
+#define FIXED_POINT_ONE                     2147483648.0f
+#define FIXED_POINT_RFFT_INIT               arm_rfft_init_q31
+#define FIXED_POINT_RFFT                    arm_rfft_q31
+#define FIXED_POINT_CMPLX_MAG               arm_cmplx_mag_q31
+#define FIXED_POINT_DOT_PROD                arm_dot_prod_q31
+#define FIXED_POINT_FILTERBANK_WEIGHTS      DSPTables_filterbankWeightsQ31
+#define FIXED_POINT_DOT_PROD_SCALE          16384.0f
+
+#endif
+
+#define FIXED_POINT_SPECTRUM_SCALE          (2.0f * NUMBER_OF_SAMPLES_IN_FRAME / FIXED_POINT_ONE * 32768.0f / MAX_INT_VALUE)
+
+/* Int8 network: tansig outputs are Q7 */
+
+#define Q7_ONE                              128.0f
+
+/* Compile-time checks of the arena layout */
+
+#define DETECTOR_STATIC_ASSERT(condition, name)     typedef char name[(condition) ? 1 : -1]
+
+DETECTOR_STATIC_ASSERT(sizeof(((mfccHistory_t*)0)->slots[0]) == NUMBER_OF_FEATURES * sizeof(float32_t), history_slot_holds_network_input);
+
+DETECTOR_STATIC_ASSERT(NUMBER_OF_SAMPLES_IN_FRAME >= NUMBER_OF_BINS_IN_FRAME, frame_buffer_holds_magnitudes);
+
+DETECTOR_STATIC_ASSERT(NUMBER_OF_FFT_OUTPUTS >= 2 * NUMBER_OF_BINS_IN_FRAME, fft_buffer_holds_spectrum);
+
+DETECTOR_STATIC_ASSERT(offsetof(detectorArena_t, featureExtractor) % 4 == 0 && offsetof(featureExtractor_t, frame) % 4 == 0 && offsetof(featureExtractor_t, cplxFFT) % 4 == 0, fft_buffers_word_aligned);
+
+#ifdef __arm__
+DETECTOR_STATIC_ASSERT(sizeof(detectorArena_t) <= DETECTOR_ARENA_MAXIMUM_SIZE, arena_within_budget);
+#endif
+
+/* Position in the MFCC history ring of the frame that is the given number of frames older than the newest */
+
+#define HISTORY_SLOT(history, age)          (((history)->head + NUMBER_OF_BUFFERS_MFCC - (age)) % NUMBER_OF_BUFFERS_MFCC)
+
+/* Hamming window (the fixed-point front end uses the Q15 table in dsptables.c) */
+
+#ifndef DETECTOR_FIXED_POINT
+static const float32_t hamming_window[NUMBER_OF_SAMPLES_IN_FRAME] = {0.080000,0.080009,0.080035,0.080078,0.080139,0.080217,0.080312,0.080425,0.080555,0.080703,0.080867,0.081049,0.081249,0.081466,0.081700,0.081951,0.082219,0.082505,0.082808,0.083129,0.083466,0.083821,0.084193,0.084582,0.084989,0.085412,0.085853,0.086311,0.086785,0.087278,0.087787,0.088313,0.088856,0.089416,0.089993,0.090588,0.091199,0.091827,0.092472,0.093134,0.093812,0.094508,0.095220,0.095950,0.096695,0.097458,0.098237,0.099033,0.099846,0.100675,0.101521,0.102383,0.103262,0.104157,0.105069,0.105997,0.106942,0.107903,0.108880,0.109873,0.110883,0.111909,0.112951,0.114009,0.115083,0.116173,0.117279,0.118402,0.119540,0.120693,0.121863,0.123049,0.124250,0.125467,0.126699,0.127947,0.129211,0.130490,0.131785,0.133095,0.134420,0.135761,0.137117,0.138488,0.139874,0.141276,0.142692,0.144123,0.145570,0.147031,0.148507,0.149998,0.151503,0.153023,0.154558,0.156107,0.157671,0.159249,0.160842,0.162449,0.164070,0.165705,0.167355,0.169018,0.170696,0.172387,0.174092,0.175811,0.177544,0.179291,0.181051,0.182824,0.184611,0.186412,0.188226,0.190053,0.191893,0.193747,0.195613,0.197493,0.199385,0.201290,0.203208,0.205139,0.207082,0.209038,0.211007,0.212988,0.214981,0.216986,0.219004,0.221033,0.223075,0.225129,0.227195,0.229272,0.231361,0.233462,0.235574,0.237698,0.239833,0.241980,0.244137,0.246306,0.248486,0.250677,0.252879,0.255092,0.257315,0.259550,0.261794,0.264050,0.266315,0.268591,0.270877,0.273174,0.275480,0.277797,0.280123,0.282459,0.284805,0.287160,0.289525,0.291900,0.294283,0.296677,0.299079,0.301490,0.303910,0.306340,0.308778,0.311224,0.313680,0.316144,0.318616,0.321097,0.323586,0.326083,0.328588,0.331101,0.333623,0.336151,0.338688,0.341232,0.343784,0.346343,0.348909,0.351483,0.354063,0.356651,0.359246,0.361847,0.364455,0.367070,0.369691,0.372319,0.374953,0.377593,0.380240,0.382892,0.385550,0.388215,0.390884,0.393560,0.396241,0.398927,0.401619,0.404316,0.407018,0.409725,0.412438,0.415154,0.417876,0.420602,0.423333,0.426068,0.428807,0.431551,0.434299,0.437050,0.439806,0.442565,0.445328,0.448095,0.450865,0.453638,0.456415,0.459195,0.461977,0.464763,0.467552,0.470343,0.473137,0.475934,0.478733,0.481534,0.484337,0.487143,0.489950,0.492760,0.495571,0.498384,0.501199,0.504014,0.506832,0.509650,0.512470,0.515291,0.518112,0.520935,0.523758,0.526582,0.529406,0.532231,0.535056,0.537881,0.540706,0.543532,0.546357,0.549182,0.552006,0.554830,0.557654,0.560477,0.563299,0.566120,0.568940,0.571759,0.574577,0.577394,0.580209,0.583023,0.585835,0.588645,0.591454,0.594260,0.597065,0.599867,0.602667,0.605465,0.608260,0.611053,0.613843,0.616630,0.619414,0.622196,0.624974,0.627749,0.630521,0.633289,0.636054,0.638815,0.641572,0.644326,0.647076,0.649821,0.652563,0.655300,0.658033,0.660762,0.663485,0.666205,0.668919,0.671629,0.674333,0.677033,0.679727,0.682416,0.685100,0.687779,0.690451,0.693118,0.695780,0.698435,0.701084,0.703728,0.706365,0.708996,0.711620,0.714238,0.716850,0.719455,0.722053,0.724644,0.727228,0.729805,0.732375,0.734938,0.737493,0.740041,0.742581,0.745114,0.747639,0.750156,0.752665,0.755167,0.757660,0.760145,0.762621,0.765089,0.767549,0.770000,0.772442,0.774876,0.777301,0.779717,0.782123,0.784521,0.786910,0.789289,0.791658,0.794019,0.796369,0.798710,0.801041,0.803363,0.805674,0.807976,0.810267,0.812548,0.814819,0.817079,0.819329,0.821569,0.823798,0.826016,0.828223,0.830420,0.832605,0.834780,0.836943,0.839095,0.841236,0.843365,0.845484,0.847590,0.849685,0.851768,0.853840,0.855899,0.857947,0.859983,0.862007,0.864018,0.866017,0.868004,0.869979,0.871941,0.873891,0.875828,0.877752,0.879664,0.881563,0.883449,0.885322,0.887182,0.889029,0.890862,0.892683,0.894490,0.896284,0.898064,0.899831,0.901584,0.903324,0.905050,0.906762,0.908461,0.910145,0.911815,0.913472,0.915114,0.916742,0.918356,0.919956,0.921542,0.923112,0.924669,0.926211,0.927739,0.929251,0.930750,0.932233,0.933702,0.935155,0.936594,0.938018,0.939427,0.940821,0.942199,0.943563,0.944911,0.946244,0.947562,0.948864,0.950151,0.951423,0.952679,0.953919,0.955144,0.956353,0.957546,0.958724,0.959885,0.961031,0.962162,0.963276,0.964374,0.965456,0.966522,0.967572,0.968606,0.969624,0.970625,0.971611,0.972580,0.973533,0.974469,0.975389,0.976292,0.977179,0.978050,0.978904,0.979742,0.980562,0.981367,0.982154,0.982925,0.983680,0.984417,0.985138,0.985842,0.986529,0.987199,0.987853,0.988489,0.989109,0.989712,0.990297,0.990866,0.991418,0.991952,0.992470,0.992971,0.993454,0.993920,0.994370,0.994802,0.995217,0.995615,0.995995,0.996359,0.996705,0.997034,0.997345,0.997640,0.997917,0.998177,0.998420,0.998645,0.998853,0.999044,0.999217,0.999373,0.999512,0.999633,0.999738,0.999824,0.999894,0.999946,0.999980,0.999998,0.999998,0.999980,0.999946,0.999894,0.999824,0.999738,0.999633,0.999512,0.999373,0.999217,0.999044,0.998853,0.998645,0.998420,0.998177,0.997917,0.997640,0.997345,0.997034,0.996705,0.996359,0.995995,0.995615,0.995217,0.994802,0.994370,0.993920,0.993454,0.992971,0.992470,0.991952,0.991418,0.990866,0.990297,0.989712,0.989109,0.988489,0.987853,0.987199,0.986529,0.985842,0.985138,0.984417,0.983680,0.982925,0.982154,0.981367,0.980562,0.979742,0.978904,0.978050,0.977179,0.976292,0.975389,0.974469,0.973533,0.972580,0.971611,0.970625,0.969624,0.968606,0.967572,0.966522,0.965456,0.964374,0.963276,0.962162,0.961031,0.959885,0.958724,0.957546,0.956353,0.955144,0.953919,0.952679,0.951423,0.950151,0.948864,0.947562,0.946244,0.944911,0.943563,0.942199,0.940821,0.939427,0.938018,0.936594,0.935155,0.933702,0.932233,0.930750,0.929251,0.927739,0.926211,0.924669,0.923112,0.921542,0.919956,0.918356,0.916742,0.915114,0.913472,0.911815,0.910145,0.908461,0.906762,0.905050,0.903324,0.901584,0.899831,0.898064,0.896284,0.894490,0.892683,0.890862,0.889029,0.887182,0.885322,0.883449,0.881563,0.879664,0.877752,0.875828,0.873891,0.871941,0.869979,0.868004,0.866017,0.864018,0.862007,0.859983,0.857947,0.855899,0.853840,0.851768,0.849685,0.847590,0.845484,0.843365,0.841236,0.839095,0.836943,0.834780,0.832605,0.830420,0.828223,0.826016,0.823798,0.821569,0.819329,0.817079,0.814819,0.812548,0.810267,0.807976,0.805674,0.803363,0.801041,0.798710,0.796369,0.794019,0.791658,0.789289,0.786910,0.784521,0.782123,0.779717,0.777301,0.774876,0.772442,0.770000,0.767549,0.765089,0.762621,0.760145,0.757660,0.755167,0.752665,0.750156,0.747639,0.745114,0.742581,0.740041,0.737493,0.734938,0.732375,0.729805,0.727228,0.724644,0.722053,0.719455,0.716850,0.714238,0.711620,0.708996,0.706365,0.703728,0.701084,0.698435,0.695780,0.693118,0.690451,0.687779,0.685100,0.682416,0.679727,0.677033,0.674333,0.671629,0.668919,0.666205,0.663485,0.660762,0.658033,0.655300,0.652563,0.649821,0.647076,0.644326,0.641572,0.638815,0.636054,0.633289,0.630521,0.627749,0.624974,0.622196,0.619414,0.616630,0.613843,0.611053,0.608260,0.605465,0.602667,0.599867,0.597065,0.594260,0.591454,0.588645,0.585835,0.583023,0.580209,0.577394,0.574577,0.571759,0.568940,0.566120,0.563299,0.560477,0.557654,0.554830,0.552006,0.549182,0.546357,0.543532,0.540706,0.537881,0.535056,0.532231,0.529406,0.526582,0.523758,0.520935,0.518112,0.515291,0.512470,0.509650,0.506832,0.504014,0.501199,0.498384,0.495571,0.492760,0.489950,0.487143,0.484337,0.481534,0.478733,0.475934,0.473137,0.470343,0.467552,0.464763,0.461977,0.459195,0.456415,0.453638,0.450865,0.448095,0.445328,0.442565,0.439806,0.437050,0.434299,0.431551,0.428807,0.426068,0.423333,0.420602,0.417876,0.415154,0.412438,0.409725,0.407018,0.404316,0.401619,0.398927,0.396241,0.393560,0.390884,0.388215,0.385550,0.382892,0.380240,0.377593,0.374953,0.372319,0.369691,0.367070,0.364455,0.361847,0.359246,0.356651,0.354063,0.351483,0.348909,0.346343,0.343784,0.341232,0.338688,0.336151,0.333623,0.331101,0.328588,0.326083,0.323586,0.321097,0.318616,0.316144,0.313680,0.311224,0.308778,0.306340,0.303910,0.301490,0.299079,0.296677,0.294283,0.291900,0.289525,0.287160,0.284805,0.282459,0.280123,0.277797,0.275480,0.273174,0.270877,0.268591,0.266315,0.264050,0.261794,0.259550,0.257315,0.255092,0.252879,0.250677,0.248486,0.246306,0.244137,0.241980,0.239833,0.237698,0.235574,0.233462,0.231361,0.229272,0.227195,0.225129,0.223075,0.221033,0.219004,0.216986,0.214981,0.212988,0.211007,0.209038,0.207082,0.205139,0.203208,0.201290,0.199385,0.197493,0.195613,0.193747,0.191893,0.190053,0.188226,0.186412,0.184611,0.182824,0.181051,0.179291,0.177544,0.175811,0.174092,0.172387,0.170696,0.169018,0.167355,0.165705,0.164070,0.162449,0.160842,0.159249,0.157671,0.156107,0.154558,0.153023,0.151503,0.149998,0.148507,0.147031,0.145570,0.144123,0.142692,0.141276,0.139874,0.138488,0.137117,0.135761,0.134420,0.133095,0.131785,0.130490,0.129211,0.127947,0.126699,0.125467,0.124250,0.123049,0.121863,0.120693,0.119540,0.118402,0.117279,0.116173,0.115083,0.114009,0.112951,0.111909,0.110883,0.109873,0.108880,0.107903,0.106942,0.105997,0.105069,0.104157,0.103262,0.102383,0.101521,0.100675,0.099846,0.099033,0.098237,0.097458,0.096695,0.095950,0.095220,0.094508,0.093812,0.093134,0.092472,0.091827,0.091199,0.090588,0.089993,0.089416,0.088856,0.088313,0.087787,0.087278,0.086785,0.086311,0.085853,0.085412,0.084989,0.084582,0.084193,0.083821,0.083466,0.083129,0.082808,0.082505,0.082219,0.081951,0.081700,0.081466,0.081249,0.081049,0.080867,0.080703,0.080555,0.080425,0.080312,0.080217,0.080139,0.080078,0.080035,0.080009,0.080000};
+#endif
+
+/* 
+ * Function: Detector_initialiseFeatureExtractor
+ * Purpose: Prepare the feature extractor context once so that no set-up work is repeated per frame.
+ * 
+ * Steps:
+ * 1. Initialise the real FFT instance.
+ * 2. Attach the Hamming window and the Mel filter banks generated into
+ *    flash by host/tablegen.c. The fixed-point front end uses the Q15 window
+ *    and the weights relative to each band maximum, keeping the scale to
+ *    apply when converting the energies to float.
+ * 3. Attach the DCT-II matrix, also generated by host/tablegen.c.
+ * 
+ * Parameters:
+ *  - extractor: Pointer to the feature extractor context.
+ */
+void Detector_initialiseFeatureExtractor(featureExtractor_t *extractor) {
+
+    extractor->bankStarts = DSPTables_filterbankStarts;
+
+    extractor->bankOffsets = DSPTables_filterbankOffsets;
+
+#ifndef DETECTOR_FIXED_POINT
+
+    arm_rfft_fast_init_f32(&extractor->realFFTinstance, NUMBER_OF_SAMPLES_IN_FRAME);
+
+    extractor->window = hamming_window;
+
+    extractor->bankWeights = DSPTables_filterbankWeights;
+
+#else
+
+    FIXED_POINT_RFFT_INIT(&extractor->realFFTinstance, NUMBER_OF_SAMPLES_IN_FRAME, 0, 1);
+
+    extractor->window = DSPTables_hammingWindowQ15;
+
+    extractor->bankWeights = FIXED_POINT_FILTERBANK_WEIGHTS;
+
+    for (int ibank = 0; ibank < NBANKS - 1; ibank += 1) {
+
+        extractor->bankScales[ibank] = DSPTables_filterbankMaxima[ibank] / FIXED_POINT_ONE * FIXED_POINT_DOT_PROD_SCALE * FIXED_POINT_SPECTRUM_SCALE;
+
+    }
+
+#endif
+
+    arm_mat_init_f32(&extractor->dctMatrix, NUMBER_OF_SAMPLES_IN_BUFFERS_MFCC, NBANKS - 1, (float32_t*)DSPTables_dctMatrix);
+
+}
+
+/* 
+ * Function: Detector_resetArena
+ * Purpose: Reset all the detector state at the start of a recording.
+ * 
+ * Steps:
+ * 1. Initialise the feature extractor.
+ * 2. Clear the MFCC history, the confirmer window, the neural network scratch
+ *    and the energy gate.
+ * 
+ * Parameters:
+ *  - arena: Pointer to the detector arena.
+ */
+void Detector_resetArena(detectorArena_t *arena) {
+
+    Detector_initialiseFeatureExtractor(&arena->featureExtractor);
+
+    Detector_resetHistory(&arena->mfccHistory);
+
+    Detector_resetWindow(&arena->mfccWindow);
+
+    memset(&arena->neuralNetwork, 0, sizeof(neuralNetwork_t));
+
+    memset(&arena->energyGate, 0, sizeof(energyGate_t));
+
+}
+
+/* 
+ * Function: Detector_applyWindow
+ * Purpose: Scale the input audio samples to [-1, 1] and apply a Hamming window.
+ *          The fixed-point front end keeps the samples in Q31.
+ * 
+ * Parameters:
+ *  - extractor: Pointer to the feature extractor context.
+ *  - bufferIN: Pointer to input audio samples.
+ *  - windowed: Pointer to store the windowed samples.
+ */
+void Detector_applyWindow(featureExtractor_t *extractor, int16_t *bufferIN, frontEnd_t *windowed) {
+
+    windowed[0] = 0;
+
+    for (int i = 1; i < NUMBER_OF_SAMPLES_IN_FRAME; i += 1) {
+#if !defined(DETECTOR_FIXED_POINT)
+        windowed[i] = extractor->window[i] * (((float32_t)*(bufferIN + i)) / (float32_t)MAX_INT_VALUE);
+#else
+        windowed[i] = 2 * (q31_t)*(bufferIN + i) * extractor->window[i];
+#endif
+    }
+
+}
+
+/* 
+ * Function: Detector_FFT
+ * Purpose: Perform the real FFT of the windowed samples.
+ * 
+ * Parameters:
+ *  - extractor: Pointer to the feature extractor context.
+ *  - windowed: Pointer to the windowed samples (used as scratch by the FFT).
+ *  - cplxFFT: Pointer to store the packed complex spectrum (the fixed-point
+ *    transforms write the unpacked bins 0 to NUMBER_OF_BINS_IN_FRAME).
+ */
+void Detector_FFT(featureExtractor_t *extractor, frontEnd_t *windowed, frontEnd_t *cplxFFT) {
+
+#ifndef DETECTOR_FIXED_POINT
+
+    arm_rfft_fast_f32(&extractor->realFFTinstance, windowed, cplxFFT, 0);
+
+#else
+
+    FIXED_POINT_RFFT(&extractor->realFFTinstance, windowed, cplxFFT);
+
+#endif
+
+}
+
+/* 
+ * Function: Detector_magnitude
+ * Purpose: Compute the magnitude of the packed complex spectrum.
+ * 
+ * Parameters:
+ *  - cplxFFT: Pointer to the packed complex spectrum (2 * NUMBER_OF_BINS_IN_FRAME values).
+ *  - spectrum: Pointer to store the magnitudes (NUMBER_OF_BINS_IN_FRAME values).
+ */
+void Detector_magnitude(frontEnd_t *cplxFFT, frontEnd_t *spectrum) {
+
+#ifndef DETECTOR_FIXED_POINT
+
+    arm_cmplx_mag_f32(cplxFFT, spectrum, NUMBER_OF_BINS_IN_FRAME);
+
+#else
+
+    FIXED_POINT_CMPLX_MAG(cplxFFT, spectrum, NUMBER_OF_BINS_IN_FRAME);
+
+#endif
+
+}
+
+/* 
+ * Function: Detector_melFilterbank
+ * Purpose: Apply the Mel filter banks to the magnitude spectrum as one
+ *          dot product per band over its contiguous span of FFT bins. The
+ *          fixed-point front end accumulates in 64 bits and converts each
+ *          energy to float, at least one LSB so that the log stays finite.
+ * 
+ * Parameters:
+ *  - extractor: Pointer to the feature extractor context.
+ *  - spectrum: Pointer to the magnitude spectrum.
+ *  - energies: Pointer to store the energy of each of the NBANKS-1 banks.
+ */
+void Detector_melFilterbank(featureExtractor_t *extractor, frontEnd_t *spectrum, float32_t *energies) {
+
+    for (int ibank = 0; ibank < NBANKS - 1; ibank += 1) {
+
+        const frontEnd_t *weights = extractor->bankWeights + extractor->bankOffsets[ibank];
+
+        uint32_t numberOfWeights = extractor->bankOffsets[ibank + 1] - extractor->bankOffsets[ibank];
+
+#ifndef DETECTOR_FIXED_POINT
+
+        arm_dot_prod_f32(spectrum + extractor->bankStarts[ibank], weights, numberOfWeights, energies + ibank);
+
+#else
+
+        q63_t sum;
+
+        FIXED_POINT_DOT_PROD(spectrum + extractor->bankStarts[ibank], weights, numberOfWeights, &sum);
+
+        energies[ibank] = (float32_t)(sum > 0 ? sum : 1) * extractor->bankScales[ibank];
+
+#endif
+
+    }
+
+}
+
+/* 
+ * Function: Detector_logEnergies
+ * Purpose: Log-transform the energies of the Mel filter banks.
+ * 
+ * Parameters:
+ *  - energies: Pointer to the energy of each bank.
+ *  - logEnergies: Pointer to store the log10 energies.
+ */
+void Detector_logEnergies(float32_t *energies, float32_t *logEnergies) {
+
+#ifdef DETECTOR_EXACT_MATH
+
+    for (int ibank = 0; ibank < NBANKS - 1; ibank += 1) {
+        logEnergies[ibank] = (float32_t)log10((double)energies[ibank]);
+    }
+
+#else
+
+    FastMath_vlog10_f32(energies, logEnergies, NBANKS - 1);
+
+#endif
+
+}
+
+/* 
+ * Function: Detector_DCTII
+ * Purpose: Perform Discrete Cosine Transform (DCT-II) on the input data.
+ * 
+ * Steps:
+ * 1. Multiply the input by the precomputed 12x40 DCT-II matrix, whose rows
+ *    already include the sqrt(2 / N) scaling.
+ * 
+ * Parameters:
+ *  - extractor: Pointer to the feature extractor context.
+ *  - indct: Pointer to input data for DCT.
+ *  - outdct: Pointer to output data for the transformed values.
+ */
+void Detector_DCTII(featureExtractor_t *extractor, float32_t *indct, float32_t *outdct) {
+
+    arm_mat_vec_mult_f32(&extractor->dctMatrix, indct, outdct);
+
+}
+
+/* 
+ * Function: Detector_MFCC
+ * Purpose: Compute Mel Frequency Cepstral Coefficients (MFCCs) from the input audio buffer.
+ * 
+ * Steps:
+ * 1. Apply a Hamming window to the input audio samples.
+ * 2. Perform an FFT to compute the frequency domain representation of the audio.
+ * 3. Apply Mel filter banks to extract relevant frequency features.
+ * 4. Log-transform the energy values of the filtered frequencies.
+ * 5. Perform a Discrete Cosine Transform (DCT) to obtain MFCCs.
+ *
+ * Parameters:
+ *  - extractor: Pointer to the initialised feature extractor context.
+ *  - bufferIN: Pointer to input audio samples.
+ *  - bufferOUT: Pointer to store the calculated MFCCs.
+ */
+void Detector_MFCC(featureExtractor_t *extractor, int16_t *bufferIN, float32_t *bufferOUT) {
+
+    // 1. Apply hamming window
+    PROFILE_START(PROFILE_WINDOW);
+    Detector_applyWindow(extractor, bufferIN, extractor->frame);
+    PROFILE_STOP(PROFILE_WINDOW);
+
+    // 2. Perform FFT (the windowed samples are no longer needed afterwards, so the frame buffer receives the magnitudes)
+    PROFILE_START(PROFILE_FFT);
+    Detector_FFT(extractor, extractor->frame, extractor->cplxFFT);
+    PROFILE_STOP(PROFILE_FFT);
+
+    PROFILE_START(PROFILE_MAGNITUDE);
+    Detector_magnitude(extractor->cplxFFT, extractor->frame);
+    PROFILE_STOP(PROFILE_MAGNITUDE);
+
+    // 3: Apply Mel filter banks and log-transform
+    PROFILE_START(PROFILE_FILTERBANK);
+    Detector_melFilterbank(extractor, extractor->frame, extractor->energies);
+    PROFILE_STOP(PROFILE_FILTERBANK);
+
+    PROFILE_START(PROFILE_LOG10);
+    Detector_logEnergies(extractor->energies, extractor->energies);
+    PROFILE_STOP(PROFILE_LOG10);
+
+    // 4: Perform DCT to obtain MFCCs
+    PROFILE_START(PROFILE_DCT);
+    Detector_DCTII(extractor, extractor->energies, bufferOUT);
+    PROFILE_STOP(PROFILE_DCT);
+
+}
+
+/* 
+ * Function: Detector_resetHistory
+ * Purpose: Clear the MFCC history at the start of a recording.
+ * 
+ * Parameters:
+ *  - history: Pointer to the MFCC history.
+ */
+void Detector_resetHistory(mfccHistory_t *history) {
+
+    memset(history, 0, sizeof(mfccHistory_t));
+
+}
+
+/* 
+ * Function: Detector_advanceHistory
+ * Purpose: Move the head of the MFCC history on by one frame, dropping the
+ *          oldest frame.
+ * 
+ * Parameters:
+ *  - history: Pointer to the MFCC history.
+ * 
+ * Returns: Pointer to the slot that receives the MFCCs of the new frame.
+ */
+float32_t* Detector_advanceHistory(mfccHistory_t *history) {
+
+    history->head = (history->head + 1) % NUMBER_OF_BUFFERS_MFCC;
+
+    return history->slots[history->head];
+
+}
+
+/* 
+ * Function: Detector_frameEnergy
+ * Purpose: Compute the mean square of the samples of a buffer in integer
+ *          arithmetic, far cheaper than the FFT it may allow to skip.
+ * 
+ * Parameters:
+ *  - bufferIN: Pointer to the NUMBER_OF_SAMPLES_IN_FRAME input samples.
+ * 
+ * Returns:
+ *  - The mean square, at most 2^30.
+ */
+uint32_t Detector_frameEnergy(const int16_t *bufferIN) {
+
+    uint64_t sum = 0;
+
+    for (uint32_t i = 0; i < NUMBER_OF_SAMPLES_IN_FRAME; i += 1) {
+        sum += (int32_t)bufferIN[i] * bufferIN[i];
+    }
+
+    return (uint32_t)(sum / NUMBER_OF_SAMPLES_IN_FRAME);
+
+}
+
+/* 
+ * Function: Detector_applyEnergyGate
+ * Purpose: Decide whether a buffer is loud enough to be classified, and
+ *          update the noise floor.
+ * 
+ * Steps:
+ * 1. Take the energy of the first buffer of a recording as the noise floor.
+ *    The floor is kept in fixed point with ENERGY_GATE_FLOOR_FRACTION_BITS
+ *    fractional bits, so that the shifted differences do not round to zero
+ *    at low levels and leave it stuck.
+ * 2. Open the gate for ENERGY_GATE_HANGOVER_FRAMES frames if the energy
+ *    exceeds the noise floor times the margin, saturating the product so
+ *    that a high floor with a high margin keeps the gate closed.
+ * 3. Move the noise floor towards the energy, quickly down and slowly up,
+ *    so that long calls do not raise it much.
+ * 
+ * Parameters:
+ *  - gate: Pointer to the energy gate.
+ *  - energy: Mean square of the buffer, from Detector_frameEnergy.
+ *  - margin: Power ratio over the noise floor that opens the gate, in units
+ *    of 1 / ENERGY_GATE_MARGIN_ONE.
+ * 
+ * Returns:
+ *  - true if the buffer should go through the MFCC and the neural network.
+ */
+bool Detector_applyEnergyGate(energyGate_t *gate, uint32_t energy, uint32_t margin) {
+
+    uint64_t scaledEnergy = (uint64_t)energy << ENERGY_GATE_FLOOR_FRACTION_BITS;
+
+    if (gate->noiseFloor == 0) gate->noiseFloor = scaledEnergy > 0 ? scaledEnergy : 1;
+
+    uint64_t threshold = margin == 0 || gate->noiseFloor <= UINT64_MAX / margin ? gate->noiseFloor * margin : UINT64_MAX;
+
+    if (scaledEnergy * ENERGY_GATE_MARGIN_ONE > threshold) gate->hangover = ENERGY_GATE_HANGOVER_FRAMES;
+
+    if (scaledEnergy < gate->noiseFloor) {
+
+        gate->noiseFloor -= (gate->noiseFloor - scaledEnergy) >> ENERGY_GATE_FALL_SHIFT;
+
+    } else {
+
+        gate->noiseFloor += (scaledEnergy - gate->noiseFloor) >> ENERGY_GATE_RISE_SHIFT;
+
+    }
+
+    if (gate->noiseFloor == 0) gate->noiseFloor = 1;
+
+    if (gate->hangover == 0) return false;
+
+    gate->hangover -= 1;
+
+    return true;
+
+}
+
+/* 
+ * Function: Detector_resetWindow
+ * Purpose: Clear the MFCC window of the confirmer at the start of a recording.
+ * 
+ * Parameters:
+ *  - window: Pointer to the MFCC window.
+ */
+void Detector_resetWindow(mfccWindow_t *window) {
+
+    memset(window, 0, sizeof(mfccWindow_t));
+
+}
+
+/* 
+ * Function: Detector_updateWindow
+ * Purpose: Copy the MFCCs of the newest frame of the history into the
+ *          window of the confirmer, dropping the oldest frame.
+ * 
+ * Parameters:
+ *  - window: Pointer to the MFCC window.
+ *  - history: Pointer to the MFCC history, holding the newest frame at its head.
+ */
+void Detector_updateWindow(mfccWindow_t *window, const mfccHistory_t *history) {
+
+    window->head = (window->head + 1) % NN_CONFIRMER_NUMBER_OF_FRAMES;
+
+    memcpy(window->frames[window->head], history->slots[history->head], sizeof(window->frames[0]));
+
+    if (window->numberOfFrames < NN_CONFIRMER_NUMBER_OF_FRAMES) window->numberOfFrames += 1;
+
+}
+
+/* 
+ * Function: Detector_windowFeatures
+ * Purpose: Reduce the MFCC window to the input of the confirmer.
+ * 
+ * Steps:
+ * 1. Starting from the oldest frame, average each MFCC over consecutive
+ *    steps of NN_CONFIRMER_FRAMES_PER_STEP frames.
+ * 2. Store the averages step after step.
+ * 
+ * Parameters:
+ *  - window: Pointer to the MFCC window.
+ * 
+ * Returns:
+ *  - Pointer to the NN_CONFIRMER_NUMBER_OF_FEATURES inputs, or NULL until
+ *    the window holds a full second of frames.
+ */
+float32_t* Detector_windowFeatures(mfccWindow_t *window) {
+
+    if (window->numberOfFrames < NN_CONFIRMER_NUMBER_OF_FRAMES) return NULL;
+
+    float32_t *features = window->features;
+
+    uint32_t frame = (window->head + 1) % NN_CONFIRMER_NUMBER_OF_FRAMES;
+
+    for (uint32_t step = 0; step < NN_CONFIRMER_NUMBER_OF_STEPS; step += 1) {
+
+        memset(features, 0, NUMBER_OF_SAMPLES_IN_BUFFERS_MFCC * sizeof(float32_t));
+
+        for (uint32_t j = 0; j < NN_CONFIRMER_FRAMES_PER_STEP; j += 1) {
+
+            for (int i = 0; i < NUMBER_OF_SAMPLES_IN_BUFFERS_MFCC; i += 1) {
+                features[i] += window->frames[frame][i] / NN_CONFIRMER_FRAMES_PER_STEP;
+            }
+
+            frame = (frame + 1) % NN_CONFIRMER_NUMBER_OF_FRAMES;
+
+        }
+
+        features += NUMBER_OF_SAMPLES_IN_BUFFERS_MFCC;
+
+    }
+
+    return window->features;
+
+}
+
+/* 
+ * Function: Detector_deltas
+ * Purpose: Calculate the delta (time-derivative) features of the centre
+ *          frame of the MFCC history.
+ * 
+ * Steps:
+ * 1. Locate the five frames of the delta window in the ring.
+ * 2. Apply the 5-tap FIR (-0.2, -0.1, 0, 0.1, 0.2) to each coefficient in a
+ *    single pass, writing the deltas after the MFCCs of the centre frame.
+ * 
+ * Parameters:
+ *  - history: Pointer to the MFCC history, holding the newest frame at its head.
+ * 
+ * Returns: Pointer to the MFCCs and deltas of the centre frame (NUMBER_OF_FEATURES values).
+ */
+float32_t* Detector_deltas(mfccHistory_t *history) {
+
+    // Define scaling factors for deltas
+    const float32_t scalep1 = 0.1;
+    const float32_t scalep2 = 0.2;
+    const float32_t scalen1 = -0.1;
+    const float32_t scalen2 = -0.2;
+
+    const float32_t *M4 = history->slots[HISTORY_SLOT(history, 0)];
+    const float32_t *M3 = history->slots[HISTORY_SLOT(history, 1)];
+    const float32_t *M1 = history->slots[HISTORY_SLOT(history, 3)];
+    const float32_t *M0 = history->slots[HISTORY_SLOT(history, 4)];
+
+    float32_t *centre = history->slots[HISTORY_SLOT(history, 2)];
+
+    float32_t *delta = centre + NUMBER_OF_SAMPLES_IN_BUFFERS_MFCC;
+
+    for (int j = 0; j < NUMBER_OF_SAMPLES_IN_BUFFERS_MFCC; j += 1) {
+        delta[j] = (scalen2 * M0[j] + scalep2 * M4[j]) + (scalen1 * M1[j] + scalep1 * M3[j]);
+    }
+
+    return centre;
+
+}
+
+/* Requantisation of an int8 layer accumulator, saturated to the given range */
+
+static int32_t requantise(int32_t accumulator, const nnLayer_t *layer, int32_t minimum, int32_t maximum) {
+
+    int64_t value = ((int64_t)accumulator * layer->multiplier + ((int64_t)1 << (layer->shift - 1))) >> layer->shift;
+
+    return value < minimum ? minimum : value > maximum ? maximum : (int32_t)value;
+
+}
+
+/* 
+ * Function: quantisedNeuralNetwork
+ * Purpose: Compute the class probabilities of an int8 model.
+ * 
+ * Steps:
+ * 1. Quantise the MFCCs and deltas to int8 with the input scale of the model.
+ * 2. For each layer, accumulate the int8 dot product of each weight row with
+ *    the inputs in 32 bits, add the int32 bias and requantise the result.
+ * 3. Look up tansig in its Q7 table, or saturate linear outputs to int8.
+ * 4. For a softmax output layer, look up the exponential of the distance of
+ *    each requantised logit to the largest one and normalise them.
+ * 5. Convert the outputs of the last layer to float.
+ * 
+ * Parameters:
+ *  - network: Pointer to the neural network scratch.
+ *  - model: Pointer to the int8 model.
+ *  - bufferMFCC: Pointer to the input MFCC data, followed by its deltas.
+ * 
+ * Returns:
+ *  - Pointer to the output of each class, in the network scratch.
+ */
+static const float32_t* quantisedNeuralNetwork(neuralNetwork_t *network, const nnModel_t *model, float32_t *bufferMFCC) {
+
+    float32_t *probabilities = network->activations[0];
+
+    q7_t *input = network->quantisedInputs;
+
+    for (int i = 0; i < model->layers[0].numberOfInputs; i += 1) {
+        float32_t value = bufferMFCC[i] * model->inputInverseScale;
+        value = value < INT8_MIN ? INT8_MIN : value > INT8_MAX ? INT8_MAX : value;
+        input[i] = (q7_t)(value < 0 ? value - 0.5f : value + 0.5f);
+    }
+
+    for (uint32_t l = 0; l < model->numberOfLayers; l += 1) {
+
+        const nnLayer_t *layer = model->layers + l;
+
+        q7_t *output = network->quantisedActivations[l % 2];
+
+        int32_t *accumulators = network->accumulators;
+
+        const q7_t *weights = layer->quantisedWeights;
+
+        for (int i = 0; i < layer->numberOfOutputs; i += 1) {
+
+            q31_t sum;
+
+            arm_dot_prod_q7(weights, input, layer->numberOfInputs, &sum);
+
+            accumulators[i] = sum + layer->quantisedBiases[i];
+
+            weights += layer->numberOfInputs;
+
+        }
+
+        if (layer->activation == NN_SOFTMAX) {
+
+            int32_t *logits = accumulators;
+
+            int32_t maximum = INT32_MIN;
+
+            for (int i = 0; i < layer->numberOfOutputs; i += 1) {
+                logits[i] = requantise(accumulators[i], layer, INT32_MIN / 2, INT32_MAX / 2);
+                if (logits[i] > maximum) maximum = logits[i];
+            }
+
+            uint32_t sum = 0;
+
+            for (int i = 0; i < layer->numberOfOutputs; i += 1) {
+                int32_t distance = maximum - logits[i];
+                logits[i] = DSPTables_softmaxExponential[distance < NN_ACTIVATION_TABLE_SIZE ? distance : NN_ACTIVATION_TABLE_SIZE - 1];
+                sum += logits[i];
+            }
+
+            for (int i = 0; i < layer->numberOfOutputs; i += 1) {
+                probabilities[i] = (float32_t)logits[i] / (float32_t)sum;
+            }
+
+            return probabilities;
+
+        }
+
+        if (l + 1 == model->numberOfLayers && layer->activation == NN_LINEAR) {
+
+            for (int i = 0; i < layer->numberOfOutputs; i += 1) {
+                probabilities[i] = (float32_t)accumulators[i] * layer->accumulatorScale;
+            }
+
+            return probabilities;
+
+        }
+
+        for (int i = 0; i < layer->numberOfOutputs; i += 1) {
+
+            if (layer->activation == NN_TANSIG) {
+                output[i] = DSPTables_tansigQ7[requantise(accumulators[i], layer, -NN_ACTIVATION_TABLE_SIZE / 2, NN_ACTIVATION_TABLE_SIZE / 2 - 1) + NN_ACTIVATION_TABLE_SIZE / 2];
+            } else {
+                output[i] = (q7_t)requantise(accumulators[i], layer, INT8_MIN, INT8_MAX);
+            }
+
+        }
+
+        input = output;
+
+    }
+
+    for (uint32_t i = 0; i < model->numberOfClasses; i += 1) {
+        probabilities[i] = (float32_t)input[i] / Q7_ONE;
+    }
+
+    return probabilities;
+
+}
+
+#ifdef DETECTOR_TABLE_ACTIVATIONS
+
+/* Hyperbolic tangent by linear interpolation in DSPTables_tanh, saturated to +-1 outside its range and for NaN */
+
+static inline float32_t tableTanh(float32_t x) {
+
+    float32_t position = fabsf(x) * TANH_TABLE_SCALE;
+
+    float32_t value = 1.0f;
+
+    if (position < NN_TANH_TABLE_SIZE) {
+
+        uint32_t index = (uint32_t)position;
+
+        float32_t fraction = position - index;
+
+        value = DSPTables_tanh[index] + fraction * (DSPTables_tanh[index + 1] - DSPTables_tanh[index]);
+
+    }
+
+    return x < 0 ? -value : value;
+
+}
+
+#endif
+
+/* 
+ * Function: applyActivation
+ * Purpose: Apply the activation of a float32 layer to its outputs for one
+ *          frame, in place. A 2-way softmax is computed as the sigmoid of
+ *          the logit difference, with one exponential (or table lookup)
+ *          instead of two.
+ * 
+ * Parameters:
+ *  - activation: Activation of the layer. Softmax is computed relative to
+ *    the largest output so that the exponentials stay finite.
+ *  - output: Pointer to the first output.
+ *  - numberOfOutputs: Number of outputs.
+ *  - stride: Distance between consecutive outputs, 1 for a single frame
+ *    and the number of frames for a column of a batch.
+ */
+static void applyActivation(nnActivation_t activation, float32_t *output, uint32_t numberOfOutputs, uint32_t stride) {
+
+    uint32_t end = numberOfOutputs * stride;
+
+    if (activation == NN_TANSIG) {
+
+        for (uint32_t i = 0; i < end; i += stride) {
+#ifdef DETECTOR_TABLE_ACTIVATIONS
+            output[i] = tableTanh(output[i]);
+#else
+            output[i] = 2 / (1 + DETECTOR_EXP(-2 * output[i])) - 1;
+#endif
+        }
+
+    } else if (activation == NN_SOFTMAX && numberOfOutputs == 2) {
+
+        float32_t difference = output[0] - output[stride];
+
+#ifdef DETECTOR_TABLE_ACTIVATIONS
+        float32_t halfTanh = 0.5f * tableTanh(0.5f * difference);
+
+        output[0] = 0.5f + halfTanh;
+
+        output[stride] = 0.5f - halfTanh;
+#else
+        /* The exponential of minus the magnitude cannot overflow, and the smaller probability keeps its relative precision */
+
+        float32_t exponential = DETECTOR_EXP(-fabsf(difference));
+
+        float32_t larger = 1 / (1 + exponential);
+
+        output[0] = difference >= 0 ? larger : exponential * larger;
+
+        output[stride] = difference >= 0 ? exponential * larger : larger;
+#endif
+
+    } else if (activation == NN_SOFTMAX) {
+
+        float32_t maximum = output[0];
+
+        for (uint32_t i = stride; i < end; i += stride) {
+            if (output[i] > maximum) maximum = output[i];
+        }
+
+        float32_t sum = 0;
+
+        for (uint32_t i = 0; i < end; i += stride) {
+            output[i] = DETECTOR_EXP(output[i] - maximum);
+            sum = sum + output[i];
+        }
+
+        for (uint32_t i = 0; i < end; i += stride) {
+            output[i] = output[i] / sum;
+        }
+
+    }
+
+}
+
+/* 
+ * Function: temporalLayer
+ * Purpose: Compute the output of a temporal layer for the current frame only.
+ * 
+ * Steps:
+ * 1. Store the input in the slot of the current frame in the ring of the
+ *    layer, overwriting the input of the oldest frame it no longer needs.
+ * 2. Start each output from its bias and add the dot product of each tap
+ *    with the stored input of dilation * tap frames before, so the work per
+ *    frame is that of a dense layer with numberOfTaps times the inputs.
+ * 
+ * Parameters:
+ *  - network: Pointer to the neural network scratch, holding the state.
+ *  - layer: Pointer to the temporal layer.
+ *  - input: Pointer to the input of the current frame.
+ *  - output: Pointer to the outputs of the layer.
+ */
+static void temporalLayer(neuralNetwork_t *network, const nnLayer_t *layer, const float32_t *input, float32_t *output) {
+
+    float32_t *state = network->temporalState + layer->stateOffset;
+
+    uint32_t slot = network->numberOfFrames % layer->numberOfStateFrames;
+
+    memcpy(state + slot * layer->numberOfInputs, input, layer->numberOfInputs * sizeof(float32_t));
+
+    for (int i = 0; i < layer->numberOfOutputs; i += 1) {
+        output[i] = layer->biases[i];
+    }
+
+    for (uint32_t tap = 0; tap < layer->numberOfTaps; tap += 1) {
+
+        uint32_t tapSlot = (slot + layer->numberOfStateFrames - tap * layer->dilation) % layer->numberOfStateFrames;
+
+        const float32_t *tapInput = state + tapSlot * layer->numberOfInputs;
+
+        const float32_t *tapWeights = layer->weights + tap * layer->numberOfOutputs * layer->numberOfInputs;
+
+        for (int i = 0; i < layer->numberOfOutputs; i += 1) {
+
+            float32_t product;
+
+            arm_dot_prod_f32(tapWeights + i * layer->numberOfInputs, tapInput, layer->numberOfInputs, &product);
+
+            output[i] += product;
+
+        }
+
+    }
+
+}
+
+/* 
+ * Function: Detector_neuralNetwork
+ * Purpose: Compute the class probabilities of the neural network given MFCCs as input.
+ *          Models in the int8 encoding are evaluated by quantisedNeuralNetwork().
+ * 
+ * Steps:
+ * 1. For each layer, multiply the weights by the outputs of the previous
+ *    layer (the MFCCs for the first one) and add the biases, with the
+ *    unrolled kernel of the layer shape if one was generated, or with
+ *    temporalLayer() for a temporal layer.
+ * 2. Apply the activation of the layer with applyActivation().
+ * 3. Return the outputs of the last layer, one per class, and advance the
+ *    frame count of the temporal layers, if any. A model with temporal
+ *    layers must therefore be run once per frame, and only by one caller.
+ * 
+ * Parameters:
+ *  - network: Pointer to the neural network scratch.
+ *  - model: Pointer to the model loaded at start-up.
+ *  - bufferMFCC: Pointer to the input MFCC data, followed by its deltas.
+ * 
+ * Returns:
+ *  - Pointer to the model->numberOfClasses outputs, in the network scratch
+ *    and valid until the next call.
+ */
+const float32_t* Detector_neuralNetwork(neuralNetwork_t *network, const nnModel_t *model, float32_t *bufferMFCC) {
+
+    if (model->encoding == NN_INT8) return quantisedNeuralNetwork(network, model, bufferMFCC);
+
+    const float32_t *input = bufferMFCC;
+
+    for (uint32_t l = 0; l < model->numberOfLayers; l += 1) {
+
+        const nnLayer_t *layer = model->layers + l;
+
+        float32_t *output = network->activations[l % 2];
+
+        if (layer->numberOfTaps > 1) {
+
+            temporalLayer(network, layer, input, output);
+
+        } else if (layer->kernel) {
+
+            layer->kernel(layer->weights, layer->biases, input, output);
+
+        } else {
+
+            arm_matrix_instance_f32 weights;
+
+            arm_mat_init_f32(&weights, layer->numberOfOutputs, layer->numberOfInputs, (float32_t*)layer->weights);
+
+            arm_mat_vec_mult_f32(&weights, input, output);
+
+            for (int i = 0; i < layer->numberOfOutputs; i += 1) {
+                output[i] = layer->biases[i] + output[i];
+            }
+
+        }
+
+        applyActivation(layer->activation, output, layer->numberOfOutputs, 1);
+
+        input = output;
+
+    }
+
+    if (model->temporalStateSize > 0) network->numberOfFrames += 1;
+
+    return input;
+
+}
+
+/* 
+ * Function: Detector_neuralNetworkBatch
+ * Purpose: Compute the class probabilities of a batch of frames with one
+ *          matrix-matrix product per layer instead of one call per frame.
+ * 
+ * Steps:
+ * 1. For models that must run frame by frame (int8, or with temporal
+ *    layers), run Detector_neuralNetwork() on each column in turn.
+ * 2. Otherwise, for each layer, multiply the weights by the matrix of the
+ *    outputs of the previous layer, one column per frame, and add the bias
+ *    of each output to its row.
+ * 3. Apply the activation of the layer to each column.
+ * 
+ * Parameters:
+ *  - batch: Pointer to the batch scratch.
+ *  - network: Pointer to the neural network scratch, for step 1.
+ *  - model: Pointer to the model loaded at start-up.
+ *  - features: Pointer to the numberOfInputs x numberOfFrames input matrix,
+ *    row major, with the MFCCs and deltas of one frame in each column.
+ *  - numberOfFrames: Number of frames, at most NN_MAXIMUM_BATCH_SIZE.
+ * 
+ * Returns:
+ *  - Pointer to the numberOfClasses x numberOfFrames output matrix, row
+ *    major, in the batch scratch and valid until the next call, or NULL if
+ *    numberOfFrames is out of range.
+ */
+const float32_t* Detector_neuralNetworkBatch(neuralNetworkBatch_t *batch, neuralNetwork_t *network, const nnModel_t *model, const float32_t *features, uint32_t numberOfFrames) {
+
+    if (numberOfFrames == 0 || numberOfFrames > NN_MAXIMUM_BATCH_SIZE) return NULL;
+
+    if (model->encoding == NN_INT8 || model->temporalStateSize > 0) {
+
+        uint32_t numberOfInputs = model->layers[0].numberOfInputs;
+
+        for (uint32_t frame = 0; frame < numberOfFrames; frame += 1) {
+
+            for (uint32_t i = 0; i < numberOfInputs; i += 1) {
+                batch->column[i] = features[i * numberOfFrames + frame];
+            }
+
+            const float32_t *outputs = Detector_neuralNetwork(network, model, batch->column);
+
+            for (uint32_t i = 0; i < model->numberOfClasses; i += 1) {
+                batch->activations[0][i * numberOfFrames + frame] = outputs[i];
+            }
+
+        }
+
+        return batch->activations[0];
+
+    }
+
+    arm_matrix_instance_f32 input;
+
+    arm_mat_init_f32(&input, model->layers[0].numberOfInputs, numberOfFrames, (float32_t*)features);
+
+    for (uint32_t l = 0; l < model->numberOfLayers; l += 1) {
+
+        const nnLayer_t *layer = model->layers + l;
+
+        arm_matrix_instance_f32 weights, output;
+
+        arm_mat_init_f32(&weights, layer->numberOfOutputs, layer->numberOfInputs, (float32_t*)layer->weights);
+
+        arm_mat_init_f32(&output, layer->numberOfOutputs, numberOfFrames, batch->activations[l % 2]);
+
+        arm_mat_mult_f32(&weights, &input, &output);
+
+        for (uint32_t i = 0; i < layer->numberOfOutputs; i += 1) {
+
+            float32_t *row = output.pData + i * numberOfFrames;
+
+            for (uint32_t frame = 0; frame < numberOfFrames; frame += 1) {
+                row[frame] = layer->biases[i] + row[frame];
+            }
+
+        }
+
+        if (layer->activation == NN_SOFTMAX) {
+
+            for (uint32_t frame = 0; frame < numberOfFrames; frame += 1) {
+                applyActivation(layer->activation, output.pData + frame, layer->numberOfOutputs, numberOfFrames);
+            }
+
+        } else {
+
+            applyActivation(layer->activation, output.pData, layer->numberOfOutputs * numberOfFrames, 1);
+
+        }
+
+        input = output;
+
+    }
+
+    return input.pData;
+
+}
+
+/* 
+ * Function: Detector_classify
+ * Purpose: Choose the class detected in a frame from the outputs of the neural network.
+ * 
+ * Parameters:
+ *  - probabilities: Pointer to the output of each class.
+ *  - thresholds: Pointer to the threshold of each class. A class whose
+ *    threshold is not finite is never detected (e.g. a background class).
+ *  - numberOfClasses: Number of classes of the model.
+ * 
+ * Returns:
+ *  - The most probable class above its threshold, or NN_NO_DETECTION.
+ */
+int32_t Detector_classify(const float32_t *probabilities, const float32_t *thresholds, uint32_t numberOfClasses) {
+
+    int32_t detectedClass = NN_NO_DETECTION;
+
+    for (uint32_t i = 0; i < numberOfClasses; i += 1) {
+
+        if (probabilities[i] > thresholds[i] && (detectedClass == NN_NO_DETECTION || probabilities[i] > probabilities[detectedClass])) detectedClass = i;
+
+    }
+
+    return detectedClass;
+
+}
+
+/* 
+ * Function: Detector_confirm
+ * Purpose: Run the confirmer of the cascade on a frame that passed the gate.
+ * 
+ * Parameters:
+ *  - network: Pointer to the neural network scratch, shared with the gate.
+ *  - confirmer: Pointer to the confirmer model.
+ *  - window: Pointer to the MFCC window.
+ *  - thresholds: Pointer to the threshold of each class of the confirmer.
+ *  - score: Set to the confirmer output of the confirmed class, if any.
+ * 
+ * Returns:
+ *  - The class confirmed by Detector_classify, or NN_NO_DETECTION, also
+ *    during the first second of a recording when the window is not full.
+ */
+int32_t Detector_confirm(neuralNetwork_t *network, const nnModel_t *confirmer, mfccWindow_t *window, const float32_t *thresholds, float32_t *score) {
+
+    float32_t *features = Detector_windowFeatures(window);
+
+    if (features == NULL) return NN_NO_DETECTION;
+
+    const float32_t *probabilities = Detector_neuralNetwork(network, confirmer, features);
+
+    int32_t detectedClass = Detector_classify(probabilities, thresholds, confirmer->numberOfClasses);
+
+    if (detectedClass != NN_NO_DETECTION) *score = probabilities[detectedClass];
+
+    return detectedClass;
+
+}
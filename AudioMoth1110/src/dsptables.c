@@ -0,0 +1,883 @@
+/****************************************************************************
+ * dsptables.c
+ * openacousticdevices.info
+ * October 2026
+ *****************************************************************************/
+
+/* Generated by host/tablegen.c - do not edit */
+
+#include "dsptables.h"
+
+/* DCT-II coefficients 1 to 12 of the log filterbank energies, scaled by sqrt(2 / N) */
+
+const float32_t DSPTables_dctMatrix[480] __attribute__((aligned(8))) = {
+     2.234344050e-01f,  2.220568576e-01f,  2.193102558e-01f,  2.152115334e-01f,
+     2.097859603e-01f,  2.030669870e-01f,  1.950960382e-01f,  1.859222574e-01f,
+     1.756022041e-01f,  1.641995049e-01f,  1.517844610e-01f,  1.384336155e-01f,
+     1.242292807e-01f,  1.092590311e-01f,  9.361516326e-02f,  7.739412678e-02f,
+     6.069592977e-02f,  4.362352218e-02f,  2.628216106e-02f,  8.778761682e-03f,
+    -8.778761682e-03f, -2.628216106e-02f, -4.362352218e-02f, -6.069592977e-02f,
+    -7.739412678e-02f, -9.361516326e-02f, -1.092590311e-01f, -1.242292807e-01f,
+    -1.384336155e-01f, -1.517844610e-01f, -1.641995049e-01f, -1.756022041e-01f,
+    -1.859222574e-01f, -1.950960382e-01f, -2.030669870e-01f, -2.097859603e-01f,
+    -2.152115334e-01f, -2.193102558e-01f, -2.220568576e-01f, -2.234344050e-01f,
+
+     2.229174926e-01f,  2.174285241e-01f,  2.065857438e-01f,  1.906561368e-01f,
+     1.700319430e-01f,  1.452209984e-01f,  1.168342309e-01f,  8.557061686e-02f,
+     5.219997026e-02f,  1.754398715e-02f, -1.754398715e-02f, -5.219997026e-02f,
+    -8.557061686e-02f, -1.168342309e-01f, -1.452209984e-01f, -1.700319430e-01f,
+    -1.906561368e-01f, -2.065857438e-01f, -2.174285241e-01f, -2.229174926e-01f,
+    -2.229174926e-01f, -2.174285241e-01f, -2.065857438e-01f, -1.906561368e-01f,
+    -1.700319430e-01f, -1.452209984e-01f, -1.168342309e-01f, -8.557061686e-02f,
+    -5.219997026e-02f, -1.754398715e-02f,  1.754398715e-02f,  5.219997026e-02f,
+     8.557061686e-02f,  1.168342309e-01f,  1.452209984e-01f,  1.700319430e-01f,
+     1.906561368e-01f,  2.065857438e-01f,  2.174285241e-01f,  2.229174926e-01f,
+
+     2.220568576e-01f,  2.097859603e-01f,  1.859222574e-01f,  1.517844610e-01f,
+     1.092590311e-01f,  6.069592977e-02f,  8.778761682e-03f, -4.362352218e-02f,
+    -9.361516326e-02f, -1.384336155e-01f, -1.756022041e-01f, -2.030669870e-01f,
+    -2.193102558e-01f, -2.234344050e-01f, -2.152115334e-01f, -1.950960382e-01f,
+    -1.641995049e-01f, -1.242292807e-01f, -7.739412678e-02f, -2.628216106e-02f,
+     2.628216106e-02f,  7.739412678e-02f,  1.242292807e-01f,  1.641995049e-01f,
+     1.950960382e-01f,  2.152115334e-01f,  2.234344050e-01f,  2.193102558e-01f,
+     2.030669870e-01f,  1.756022041e-01f,  1.384336155e-01f,  9.361516326e-02f,
+     4.362352218e-02f, -8.778761682e-03f, -6.069592977e-02f, -1.092590311e-01f,
+    -1.517844610e-01f, -1.859222574e-01f, -2.097859603e-01f, -2.220568576e-01f,
+
+     2.208538270e-01f,  1.992351156e-01f,  1.581138830e-01f,  1.015153619e-01f,
+     3.497980979e-02f, -3.497980979e-02f, -1.015153619e-01f, -1.581138830e-01f,
+    -1.992351156e-01f, -2.208538270e-01f, -2.208538270e-01f, -1.992351156e-01f,
+    -1.581138830e-01f, -1.015153619e-01f, -3.497980979e-02f,  3.497980979e-02f,
+     1.015153619e-01f,  1.581138830e-01f,  1.992351156e-01f,  2.208538270e-01f,
+     2.208538270e-01f,  1.992351156e-01f,  1.581138830e-01f,  1.015153619e-01f,
+     3.497980979e-02f, -3.497980979e-02f, -1.015153619e-01f, -1.581138830e-01f,
+    -1.992351156e-01f, -2.208538270e-01f, -2.208538270e-01f, -1.992351156e-01f,
+    -1.581138830e-01f, -1.015153619e-01f, -3.497980979e-02f,  3.497980979e-02f,
+     1.015153619e-01f,  1.581138830e-01f,  1.992351156e-01f,  2.208538270e-01f,
+
+     2.193102558e-01f,  1.859222574e-01f,  1.242292807e-01f,  4.362352218e-02f,
+    -4.362352218e-02f, -1.242292807e-01f, -1.859222574e-01f, -2.193102558e-01f,
+    -2.193102558e-01f, -1.859222574e-01f, -1.242292807e-01f, -4.362352218e-02f,
+     4.362352218e-02f,  1.242292807e-01f,  1.859222574e-01f,  2.193102558e-01f,
+     2.193102558e-01f,  1.859222574e-01f,  1.242292807e-01f,  4.362352218e-02f,
+    -4.362352218e-02f, -1.242292807e-01f, -1.859222574e-01f, -2.193102558e-01f,
+    -2.193102558e-01f, -1.859222574e-01f, -1.242292807e-01f, -4.362352218e-02f,
+     4.362352218e-02f,  1.242292807e-01f,  1.859222574e-01f,  2.193102558e-01f,
+     2.193102558e-01f,  1.859222574e-01f,  1.242292807e-01f,  4.362352218e-02f,
+    -4.362352218e-02f, -1.242292807e-01f, -1.859222574e-01f, -2.193102558e-01f,
+
+     2.174285241e-01f,  1.700319430e-01f,  8.557061686e-02f, -1.754398715e-02f,
+    -1.168342309e-01f, -1.906561368e-01f, -2.229174926e-01f, -2.065857438e-01f,
+    -1.452209984e-01f, -5.219997026e-02f,  5.219997026e-02f,  1.452209984e-01f,
+     2.065857438e-01f,  2.229174926e-01f,  1.906561368e-01f,  1.168342309e-01f,
+     1.754398715e-02f, -8.557061686e-02f, -1.700319430e-01f, -2.174285241e-01f,
+    -2.174285241e-01f, -1.700319430e-01f, -8.557061686e-02f,  1.754398715e-02f,
+     1.168342309e-01f,  1.906561368e-01f,  2.229174926e-01f,  2.065857438e-01f,
+     1.452209984e-01f,  5.219997026e-02f, -5.219997026e-02f, -1.452209984e-01f,
+    -2.065857438e-01f, -2.229174926e-01f, -1.906561368e-01f, -1.168342309e-01f,
+    -1.754398715e-02f,  8.557061686e-02f,  1.700319430e-01f,  2.174285241e-01f,
+
+     2.152115334e-01f,  1.517844610e-01f,  4.362352218e-02f, -7.739412678e-02f,
+    -1.756022041e-01f, -2.220568576e-01f, -2.030669870e-01f, -1.242292807e-01f,
+    -8.778761682e-03f,  1.092590311e-01f,  1.950960382e-01f,  2.234344050e-01f,
+     1.859222574e-01f,  9.361516326e-02f, -2.628216106e-02f, -1.384336155e-01f,
+    -2.097859603e-01f, -2.193102558e-01f, -1.641995049e-01f, -6.069592977e-02f,
+     6.069592977e-02f,  1.641995049e-01f,  2.193102558e-01f,  2.097859603e-01f,
+     1.384336155e-01f,  2.628216106e-02f, -9.361516326e-02f, -1.859222574e-01f,
+    -2.234344050e-01f, -1.950960382e-01f, -1.092590311e-01f,  8.778761682e-03f,
+     1.242292807e-01f,  2.030669870e-01f,  2.220568576e-01f,  1.756022041e-01f,
+     7.739412678e-02f, -4.362352218e-02f, -1.517844610e-01f, -2.152115334e-01f,
+
+     2.126627021e-01f,  1.314327780e-01f,  1.369196746e-17f, -1.314327780e-01f,
+    -2.126627021e-01f, -2.126627021e-01f, -1.314327780e-01f, -4.107590237e-17f,
+     1.314327780e-01f,  2.126627021e-01f,  2.126627021e-01f,  1.314327780e-01f,
+     6.845983728e-17f, -1.314327780e-01f, -2.126627021e-01f, -2.126627021e-01f,
+    -1.314327780e-01f, -9.584377220e-17f,  1.314327780e-01f,  2.126627021e-01f,
+     2.126627021e-01f,  1.314327780e-01f,  1.232277071e-16f, -1.314327780e-01f,
+    -2.126627021e-01f, -2.126627021e-01f, -1.314327780e-01f,  2.465938225e-16f,
+     1.314327780e-01f,  2.126627021e-01f,  2.126627021e-01f,  1.314327780e-01f,
+     5.752010415e-16f, -1.314327780e-01f, -2.126627021e-01f, -2.126627021e-01f,
+    -1.314327780e-01f, -6.025849764e-16f,  1.314327780e-01f,  2.126627021e-01f,
+
+     2.097859603e-01f,  1.092590311e-01f, -4.362352218e-02f, -1.756022041e-01f,
+    -2.234344050e-01f, -1.641995049e-01f, -2.628216106e-02f,  1.242292807e-01f,
+     2.152115334e-01f,  2.030669870e-01f,  9.361516326e-02f, -6.069592977e-02f,
+    -1.859222574e-01f, -2.220568576e-01f, -1.517844610e-01f, -8.778761682e-03f,
+     1.384336155e-01f,  2.193102558e-01f,  1.950960382e-01f,  7.739412678e-02f,
+    -7.739412678e-02f, -1.950960382e-01f, -2.193102558e-01f, -1.384336155e-01f,
+     8.778761682e-03f,  1.517844610e-01f,  2.220568576e-01f,  1.859222574e-01f,
+     6.069592977e-02f, -9.361516326e-02f, -2.030669870e-01f, -2.152115334e-01f,
+    -1.242292807e-01f,  2.628216106e-02f,  1.641995049e-01f,  2.234344050e-01f,
+     1.756022041e-01f,  4.362352218e-02f, -1.092590311e-01f, -2.097859603e-01f,
+
+     2.065857438e-01f,  8.557061686e-02f, -8.557061686e-02f, -2.065857438e-01f,
+    -2.065857438e-01f, -8.557061686e-02f,  8.557061686e-02f,  2.065857438e-01f,
+     2.065857438e-01f,  8.557061686e-02f, -8.557061686e-02f, -2.065857438e-01f,
+    -2.065857438e-01f, -8.557061686e-02f,  8.557061686e-02f,  2.065857438e-01f,
+     2.065857438e-01f,  8.557061686e-02f, -8.557061686e-02f, -2.065857438e-01f,
+    -2.065857438e-01f, -8.557061686e-02f,  8.557061686e-02f,  2.065857438e-01f,
+     2.065857438e-01f,  8.557061686e-02f, -8.557061686e-02f, -2.065857438e-01f,
+    -2.065857438e-01f, -8.557061686e-02f,  8.557061686e-02f,  2.065857438e-01f,
+     2.065857438e-01f,  8.557061686e-02f, -8.557061686e-02f, -2.065857438e-01f,
+    -2.065857438e-01f, -8.557061686e-02f,  8.557061686e-02f,  2.065857438e-01f,
+
+     2.030669870e-01f,  6.069592977e-02f, -1.242292807e-01f, -2.220568576e-01f,
+    -1.641995049e-01f,  8.778761682e-03f,  1.756022041e-01f,  2.193102558e-01f,
+     1.092590311e-01f, -7.739412678e-02f, -2.097859603e-01f, -1.950960382e-01f,
+    -4.362352218e-02f,  1.384336155e-01f,  2.234344050e-01f,  1.517844610e-01f,
+    -2.628216106e-02f, -1.859222574e-01f, -2.152115334e-01f, -9.361516326e-02f,
+     9.361516326e-02f,  2.152115334e-01f,  1.859222574e-01f,  2.628216106e-02f,
+    -1.517844610e-01f, -2.234344050e-01f, -1.384336155e-01f,  4.362352218e-02f,
+     1.950960382e-01f,  2.097859603e-01f,  7.739412678e-02f, -1.092590311e-01f,
+    -2.193102558e-01f, -1.756022041e-01f, -8.778761682e-03f,  1.641995049e-01f,
+     2.220568576e-01f,  1.242292807e-01f, -6.069592977e-02f, -2.030669870e-01f,
+
+     1.992351156e-01f,  3.497980979e-02f, -1.581138830e-01f, -2.208538270e-01f,
+    -1.015153619e-01f,  1.015153619e-01f,  2.208538270e-01f,  1.581138830e-01f,
+    -3.497980979e-02f, -1.992351156e-01f, -1.992351156e-01f, -3.497980979e-02f,
+     1.581138830e-01f,  2.208538270e-01f,  1.015153619e-01f, -1.015153619e-01f,
+    -2.208538270e-01f, -1.581138830e-01f,  3.497980979e-02f,  1.992351156e-01f,
+     1.992351156e-01f,  3.497980979e-02f, -1.581138830e-01f, -2.208538270e-01f,
+    -1.015153619e-01f,  1.015153619e-01f,  2.208538270e-01f,  1.581138830e-01f,
+    -3.497980979e-02f, -1.992351156e-01f, -1.992351156e-01f, -3.497980979e-02f,
+     1.581138830e-01f,  2.208538270e-01f,  1.015153619e-01f, -1.015153619e-01f,
+    -2.208538270e-01f, -1.581138830e-01f,  3.497980979e-02f,  1.992351156e-01f
+};
+
+/* Hamming window in Q15 */
+
+const q15_t DSPTables_hammingWindowQ15[1024] __attribute__((aligned(8))) = {
+      2621,   2622,   2623,   2624,   2626,   2629,   2632,   2635,
+      2640,   2644,   2650,   2656,   2662,   2669,   2677,   2685,
+      2694,   2704,   2713,   2724,   2735,   2747,   2759,   2772,
+      2785,   2799,   2813,   2828,   2844,   2860,   2877,   2894,
+      2912,   2930,   2949,   2968,   2988,   3009,   3030,   3052,
+      3074,   3097,   3120,   3144,   3169,   3194,   3219,   3245,
+      3272,   3299,   3327,   3355,   3384,   3413,   3443,   3473,
+      3504,   3536,   3568,   3600,   3633,   3667,   3701,   3736,
+      3771,   3807,   3843,   3880,   3917,   3955,   3993,   4032,
+      4071,   4111,   4152,   4193,   4234,   4276,   4318,   4361,
+      4405,   4449,   4493,   4538,   4583,   4629,   4676,   4723,
+      4770,   4818,   4866,   4915,   4964,   5014,   5065,   5115,
+      5167,   5218,   5270,   5323,   5376,   5430,   5484,   5538,
+      5593,   5649,   5705,   5761,   5818,   5875,   5933,   5991,
+      6049,   6108,   6168,   6228,   6288,   6349,   6410,   6471,
+      6533,   6596,   6659,   6722,   6786,   6850,   6914,   6979,
+      7044,   7110,   7176,   7243,   7310,   7377,   7445,   7513,
+      7581,   7650,   7719,   7789,   7859,   7929,   8000,   8071,
+      8142,   8214,   8286,   8359,   8432,   8505,   8578,   8652,
+      8727,   8801,   8876,   8951,   9027,   9103,   9179,   9256,
+      9332,   9410,   9487,   9565,   9643,   9721,   9800,   9879,
+      9959,  10038,  10118,  10198,  10279,  10359,  10440,  10522,
+     10603,  10685,  10767,  10850,  10932,  11015,  11098,  11181,
+     11265,  11349,  11433,  11517,  11602,  11687,  11772,  11857,
+     11942,  12028,  12114,  12200,  12286,  12373,  12460,  12547,
+     12634,  12721,  12808,  12896,  12984,  13072,  13160,  13249,
+     13337,  13426,  13515,  13604,  13693,  13782,  13872,  13961,
+     14051,  14141,  14231,  14321,  14412,  14502,  14593,  14683,
+     14774,  14865,  14956,  15047,  15138,  15229,  15321,  15412,
+     15504,  15595,  15687,  15779,  15871,  15963,  16055,  16147,
+     16239,  16331,  16423,  16516,  16608,  16700,  16793,  16885,
+     16978,  17070,  17163,  17255,  17348,  17440,  17533,  17625,
+     17718,  17810,  17903,  17996,  18088,  18181,  18273,  18366,
+     18458,  18551,  18643,  18735,  18828,  18920,  19012,  19104,
+     19197,  19289,  19381,  19473,  19565,  19656,  19748,  19840,
+     19931,  20023,  20114,  20206,  20297,  20388,  20479,  20570,
+     20661,  20752,  20842,  20933,  21023,  21113,  21203,  21293,
+     21383,  21473,  21562,  21652,  21741,  21830,  21919,  22008,
+     22097,  22185,  22273,  22361,  22449,  22537,  22625,  22712,
+     22799,  22886,  22973,  23060,  23146,  23232,  23318,  23404,
+     23490,  23575,  23660,  23745,  23830,  23914,  23998,  24082,
+     24166,  24250,  24333,  24416,  24499,  24581,  24663,  24745,
+     24827,  24908,  24990,  25070,  25151,  25231,  25311,  25391,
+     25471,  25550,  25629,  25707,  25785,  25863,  25941,  26018,
+     26095,  26172,  26249,  26325,  26400,  26476,  26551,  26626,
+     26700,  26774,  26848,  26921,  26994,  27067,  27139,  27211,
+     27283,  27354,  27425,  27495,  27566,  27635,  27705,  27774,
+     27842,  27911,  27979,  28046,  28113,  28180,  28246,  28312,
+     28378,  28443,  28507,  28572,  28636,  28699,  28762,  28825,
+     28887,  28949,  29010,  29071,  29132,  29192,  29251,  29311,
+     29369,  29428,  29486,  29543,  29600,  29657,  29713,  29768,
+     29824,  29878,  29933,  29986,  30040,  30093,  30145,  30197,
+     30249,  30300,  30350,  30400,  30450,  30499,  30547,  30596,
+     30643,  30690,  30737,  30783,  30829,  30874,  30919,  30963,
+     31007,  31050,  31092,  31135,  31176,  31217,  31258,  31298,
+     31338,  31377,  31415,  31454,  31491,  31528,  31565,  31601,
+     31636,  31671,  31705,  31739,  31773,  31805,  31838,  31869,
+     31901,  31931,  31962,  31991,  32020,  32049,  32077,  32104,
+     32131,  32157,  32183,  32208,  32233,  32257,  32281,  32304,
+     32327,  32349,  32370,  32391,  32411,  32431,  32450,  32469,
+     32487,  32504,  32521,  32538,  32554,  32569,  32584,  32598,
+     32611,  32624,  32637,  32649,  32660,  32671,  32681,  32691,
+     32700,  32708,  32716,  32724,  32730,  32737,  32742,  32747,
+     32752,  32756,  32759,  32762,  32765,  32766,  32767,  32767,
+     32767,  32767,  32766,  32765,  32762,  32759,  32756,  32752,
+     32747,  32742,  32737,  32730,  32724,  32716,  32708,  32700,
+     32691,  32681,  32671,  32660,  32649,  32637,  32624,  32611,
+     32598,  32584,  32569,  32554,  32538,  32521,  32504,  32487,
+     32469,  32450,  32431,  32411,  32391,  32370,  32349,  32327,
+     32304,  32281,  32257,  32233,  32208,  32183,  32157,  32131,
+     32104,  32077,  32049,  32020,  31991,  31962,  31931,  31901,
+     31869,  31838,  31805,  31773,  31739,  31705,  31671,  31636,
+     31601,  31565,  31528,  31491,  31454,  31415,  31377,  31338,
+     31298,  31258,  31217,  31176,  31135,  31092,  31050,  31007,
+     30963,  30919,  30874,  30829,  30783,  30737,  30690,  30643,
+     30596,  30547,  30499,  30450,  30400,  30350,  30300,  30249,
+     30197,  30145,  30093,  30040,  29986,  29933,  29878,  29824,
+     29768,  29713,  29657,  29600,  29543,  29486,  29428,  29369,
+     29311,  29251,  29192,  29132,  29071,  29010,  28949,  28887,
+     28825,  28762,  28699,  28636,  28572,  28507,  28443,  28378,
+     28312,  28246,  28180,  28113,  28046,  27979,  27911,  27842,
+     27774,  27705,  27635,  27566,  27495,  27425,  27354,  27283,
+     27211,  27139,  27067,  26994,  26921,  26848,  26774,  26700,
+     26626,  26551,  26476,  26400,  26325,  26249,  26172,  26095,
+     26018,  25941,  25863,  25785,  25707,  25629,  25550,  25471,
+     25391,  25311,  25231,  25151,  25070,  24990,  24908,  24827,
+     24745,  24663,  24581,  24499,  24416,  24333,  24250,  24166,
+     24082,  23998,  23914,  23830,  23745,  23660,  23575,  23490,
+     23404,  23318,  23232,  23146,  23060,  22973,  22886,  22799,
+     22712,  22625,  22537,  22449,  22361,  22273,  22185,  22097,
+     22008,  21919,  21830,  21741,  21652,  21562,  21473,  21383,
+     21293,  21203,  21113,  21023,  20933,  20842,  20752,  20661,
+     20570,  20479,  20388,  20297,  20206,  20114,  20023,  19931,
+     19840,  19748,  19656,  19565,  19473,  19381,  19289,  19197,
+     19104,  19012,  18920,  18828,  18735,  18643,  18551,  18458,
+     18366,  18273,  18181,  18088,  17996,  17903,  17810,  17718,
+     17625,  17533,  17440,  17348,  17255,  17163,  17070,  16978,
+     16885,  16793,  16700,  16608,  16516,  16423,  16331,  16239,
+     16147,  16055,  15963,  15871,  15779,  15687,  15595,  15504,
+     15412,  15321,  15229,  15138,  15047,  14956,  14865,  14774,
+     14683,  14593,  14502,  14412,  14321,  14231,  14141,  14051,
+     13961,  13872,  13782,  13693,  13604,  13515,  13426,  13337,
+     13249,  13160,  13072,  12984,  12896,  12808,  12721,  12634,
+     12547,  12460,  12373,  12286,  12200,  12114,  12028,  11942,
+     11857,  11772,  11687,  11602,  11517,  11433,  11349,  11265,
+     11181,  11098,  11015,  10932,  10850,  10767,  10685,  10603,
+     10522,  10440,  10359,  10279,  10198,  10118,  10038,   9959,
+      9879,   9800,   9721,   9643,   9565,   9487,   9410,   9332,
+      9256,   9179,   9103,   9027,   8951,   8876,   8801,   8727,
+      8652,   8578,   8505,   8432,   8359,   8286,   8214,   8142,
+      8071,   8000,   7929,   7859,   7789,   7719,   7650,   7581,
+      7513,   7445,   7377,   7310,   7243,   7176,   7110,   7044,
+      6979,   6914,   6850,   6786,   6722,   6659,   6596,   6533,
+      6471,   6410,   6349,   6288,   6228,   6168,   6108,   6049,
+      5991,   5933,   5875,   5818,   5761,   5705,   5649,   5593,
+      5538,   5484,   5430,   5376,   5323,   5270,   5218,   5167,
+      5115,   5065,   5014,   4964,   4915,   4866,   4818,   4770,
+      4723,   4676,   4629,   4583,   4538,   4493,   4449,   4405,
+      4361,   4318,   4276,   4234,   4193,   4152,   4111,   4071,
+      4032,   3993,   3955,   3917,   3880,   3843,   3807,   3771,
+      3736,   3701,   3667,   3633,   3600,   3568,   3536,   3504,
+      3473,   3443,   3413,   3384,   3355,   3327,   3299,   3272,
+      3245,   3219,   3194,   3169,   3144,   3120,   3097,   3074,
+      3052,   3030,   3009,   2988,   2968,   2949,   2930,   2912,
+      2894,   2877,   2860,   2844,   2828,   2813,   2799,   2785,
+      2772,   2759,   2747,   2735,   2724,   2713,   2704,   2694,
+      2685,   2677,   2669,   2662,   2656,   2650,   2644,   2640,
+      2635,   2632,   2629,   2626,   2624,   2623,   2622,   2621
+};
+
+/* First FFT bin of each Mel band */
+
+const uint16_t DSPTables_filterbankStarts[40] __attribute__((aligned(8))) = {
+       11,    13,    16,    18,    21,    24,    27,    30,
+       34,    38,    42,    46,    51,    55,    61,    66,
+       72,    79,    86,    93,   101,   110,   119,   128,
+      139,   150,   162,   174,   188,   202,   218,   234,
+      252,   271,   291,   313,   336,   361,   387,   415
+};
+
+/* Offset of each Mel band in the weights, followed by the number of weights */
+
+const uint16_t DSPTables_filterbankOffsets[41] __attribute__((aligned(8))) = {
+        0,     4,     8,    12,    17,    22,    27,    33,
+       40,    47,    54,    62,    70,    79,    89,    99,
+      111,   124,   137,   151,   167,   184,   201,   220,
+      241,   263,   286,   311,   338,   367,   398,   431,
+      467,   505,   546,   590,   637,   687,   740,   798,
+      860
+};
+
+/* Nonzero weights of the Mel bands, band after band */
+
+const float32_t DSPTables_filterbankWeights[860] __attribute__((aligned(8))) = {
+     6.387500000e-03f,  1.277500000e-02f,  8.516666667e-03f,  4.258333333e-03f,
+     4.258333333e-03f,  8.516666667e-03f,  1.277500000e-02f,  6.387500000e-03f,
+     6.387500000e-03f,  1.277500000e-02f,  8.516666667e-03f,  4.258333333e-03f,
+     3.548611111e-03f,  7.097222222e-03f,  1.064583333e-02f,  7.097222222e-03f,
+     3.548611111e-03f,  3.548611111e-03f,  7.097222222e-03f,  1.064583333e-02f,
+     7.097222222e-03f,  3.548611111e-03f,  3.548611111e-03f,  7.097222222e-03f,
+     1.064583333e-02f,  7.097222222e-03f,  3.548611111e-03f,  3.041666667e-03f,
+     6.083333333e-03f,  9.125000000e-03f,  6.843750000e-03f,  4.562500000e-03f,
+     2.281250000e-03f,  1.996093750e-03f,  3.992187500e-03f,  5.988281250e-03f,
+     7.984375000e-03f,  5.988281250e-03f,  3.992187500e-03f,  1.996093750e-03f,
+     1.996093750e-03f,  3.992187500e-03f,  5.988281250e-03f,  7.984375000e-03f,
+     5.988281250e-03f,  3.992187500e-03f,  1.996093750e-03f,  1.996093750e-03f,
+     3.992187500e-03f,  5.988281250e-03f,  7.984375000e-03f,  5.988281250e-03f,
+     3.992187500e-03f,  1.996093750e-03f,  1.774305556e-03f,  3.548611111e-03f,
+     5.322916667e-03f,  7.097222222e-03f,  5.677777778e-03f,  4.258333333e-03f,
+     2.838888889e-03f,  1.419444444e-03f,  1.419444444e-03f,  2.838888889e-03f,
+     4.258333333e-03f,  5.677777778e-03f,  7.097222222e-03f,  5.322916667e-03f,
+     3.548611111e-03f,  1.774305556e-03f,  1.596875000e-03f,  3.193750000e-03f,
+     4.790625000e-03f,  6.387500000e-03f,  5.322916667e-03f,  4.258333333e-03f,
+     3.193750000e-03f,  2.129166667e-03f,  1.064583333e-03f,  9.678030303e-04f,
+     1.935606061e-03f,  2.903409091e-03f,  3.871212121e-03f,  4.839015152e-03f,
+     5.806818182e-03f,  4.645454545e-03f,  3.484090909e-03f,  2.322727273e-03f,
+     1.161363636e-03f,  1.161363636e-03f,  2.322727273e-03f,  3.484090909e-03f,
+     4.645454545e-03f,  5.806818182e-03f,  4.839015152e-03f,  3.871212121e-03f,
+     2.903409091e-03f,  1.935606061e-03f,  9.678030303e-04f,  8.189102564e-04f,
+     1.637820513e-03f,  2.456730769e-03f,  3.275641026e-03f,  4.094551282e-03f,
+     4.913461538e-03f,  4.211538462e-03f,  3.509615385e-03f,  2.807692308e-03f,
+     2.105769231e-03f,  1.403846154e-03f,  7.019230769e-04f,  6.517857143e-04f,
+     1.303571429e-03f,  1.955357143e-03f,  2.607142857e-03f,  3.258928571e-03f,
+     3.910714286e-03f,  4.562500000e-03f,  3.910714286e-03f,  3.258928571e-03f,
+     2.607142857e-03f,  1.955357143e-03f,  1.303571429e-03f,  6.517857143e-04f,
+     6.517857143e-04f,  1.303571429e-03f,  1.955357143e-03f,  2.607142857e-03f,
+     3.258928571e-03f,  3.910714286e-03f,  4.562500000e-03f,  3.910714286e-03f,
+     3.258928571e-03f,  2.607142857e-03f,  1.955357143e-03f,  1.303571429e-03f,
+     6.517857143e-04f,  6.083333333e-04f,  1.216666667e-03f,  1.825000000e-03f,
+     2.433333333e-03f,  3.041666667e-03f,  3.650000000e-03f,  4.258333333e-03f,
+     3.726041667e-03f,  3.193750000e-03f,  2.661458333e-03f,  2.129166667e-03f,
+     1.596875000e-03f,  1.064583333e-03f,  5.322916667e-04f,  4.696691176e-04f,
+     9.393382353e-04f,  1.409007353e-03f,  1.878676471e-03f,  2.348345588e-03f,
+     2.818014706e-03f,  3.287683824e-03f,  3.757352941e-03f,  3.339869281e-03f,
+     2.922385621e-03f,  2.504901961e-03f,  2.087418301e-03f,  1.669934641e-03f,
+     1.252450980e-03f,  8.349673203e-04f,  4.174836601e-04f,  3.942901235e-04f,
+     7.885802469e-04f,  1.182870370e-03f,  1.577160494e-03f,  1.971450617e-03f,
+     2.365740741e-03f,  2.760030864e-03f,  3.154320988e-03f,  3.548611111e-03f,
+     3.154320988e-03f,  2.760030864e-03f,  2.365740741e-03f,  1.971450617e-03f,
+     1.577160494e-03f,  1.182870370e-03f,  7.885802469e-04f,  3.942901235e-04f,
+     3.942901235e-04f,  7.885802469e-04f,  1.182870370e-03f,  1.577160494e-03f,
+     1.971450617e-03f,  2.365740741e-03f,  2.760030864e-03f,  3.154320988e-03f,
+     3.548611111e-03f,  3.154320988e-03f,  2.760030864e-03f,  2.365740741e-03f,
+     1.971450617e-03f,  1.577160494e-03f,  1.182870370e-03f,  7.885802469e-04f,
+     3.942901235e-04f,  3.548611111e-04f,  7.097222222e-04f,  1.064583333e-03f,
+     1.419444444e-03f,  1.774305556e-03f,  2.129166667e-03f,  2.484027778e-03f,
+     2.838888889e-03f,  3.193750000e-03f,  2.903409091e-03f,  2.613068182e-03f,
+     2.322727273e-03f,  2.032386364e-03f,  1.742045455e-03f,  1.451704545e-03f,
+     1.161363636e-03f,  8.710227273e-04f,  5.806818182e-04f,  2.903409091e-04f,
+     2.639462810e-04f,  5.278925620e-04f,  7.918388430e-04f,  1.055785124e-03f,
+     1.319731405e-03f,  1.583677686e-03f,  1.847623967e-03f,  2.111570248e-03f,
+     2.375516529e-03f,  2.639462810e-03f,  2.903409091e-03f,  2.639462810e-03f,
+     2.375516529e-03f,  2.111570248e-03f,  1.847623967e-03f,  1.583677686e-03f,
+     1.319731405e-03f,  1.055785124e-03f,  7.918388430e-04f,  5.278925620e-04f,
+     2.639462810e-04f,  2.524703557e-04f,  5.049407115e-04f,  7.574110672e-04f,
+     1.009881423e-03f,  1.262351779e-03f,  1.514822134e-03f,  1.767292490e-03f,
+     2.019762846e-03f,  2.272233202e-03f,  2.524703557e-03f,  2.777173913e-03f,
+     2.545742754e-03f,  2.314311594e-03f,  2.082880435e-03f,  1.851449275e-03f,
+     1.620018116e-03f,  1.388586957e-03f,  1.157155797e-03f,  9.257246377e-04f,
+     6.942934783e-04f,  4.628623188e-04f,  2.314311594e-04f,  2.217881944e-04f,
+     4.435763889e-04f,  6.653645833e-04f,  8.871527778e-04f,  1.108940972e-03f,
+     1.330729167e-03f,  1.552517361e-03f,  1.774305556e-03f,  1.996093750e-03f,
+     2.217881944e-03f,  2.439670139e-03f,  2.661458333e-03f,  2.439670139e-03f,
+     2.217881944e-03f,  1.996093750e-03f,  1.774305556e-03f,  1.552517361e-03f,
+     1.330729167e-03f,  1.108940972e-03f,  8.871527778e-04f,  6.653645833e-04f,
+     4.435763889e-04f,  2.217881944e-04f,  2.047275641e-04f,  4.094551282e-04f,
+     6.141826923e-04f,  8.189102564e-04f,  1.023637821e-03f,  1.228365385e-03f,
+     1.433092949e-03f,  1.637820513e-03f,  1.842548077e-03f,  2.047275641e-03f,
+     2.252003205e-03f,  2.456730769e-03f,  2.281250000e-03f,  2.105769231e-03f,
+     1.930288462e-03f,  1.754807692e-03f,  1.579326923e-03f,  1.403846154e-03f,
+     1.228365385e-03f,  1.052884615e-03f,  8.774038462e-04f,  7.019230769e-04f,
+     5.264423077e-04f,  3.509615385e-04f,  1.754807692e-04f,  1.629464286e-04f,
+     3.258928571e-04f,  4.888392857e-04f,  6.517857143e-04f,  8.147321429e-04f,
+     9.776785714e-04f,  1.140625000e-03f,  1.303571429e-03f,  1.466517857e-03f,
+     1.629464286e-03f,  1.792410714e-03f,  1.955357143e-03f,  2.118303571e-03f,
+     2.281250000e-03f,  2.118303571e-03f,  1.955357143e-03f,  1.792410714e-03f,
+     1.629464286e-03f,  1.466517857e-03f,  1.303571429e-03f,  1.140625000e-03f,
+     9.776785714e-04f,  8.147321429e-04f,  6.517857143e-04f,  4.888392857e-04f,
+     3.258928571e-04f,  1.629464286e-04f,  1.520833333e-04f,  3.041666667e-04f,
+     4.562500000e-04f,  6.083333333e-04f,  7.604166667e-04f,  9.125000000e-04f,
+     1.064583333e-03f,  1.216666667e-03f,  1.368750000e-03f,  1.520833333e-03f,
+     1.672916667e-03f,  1.825000000e-03f,  1.977083333e-03f,  2.129166667e-03f,
+     1.996093750e-03f,  1.863020833e-03f,  1.729947917e-03f,  1.596875000e-03f,
+     1.463802083e-03f,  1.330729167e-03f,  1.197656250e-03f,  1.064583333e-03f,
+     9.315104167e-04f,  7.984375000e-04f,  6.653645833e-04f,  5.322916667e-04f,
+     3.992187500e-04f,  2.661458333e-04f,  1.330729167e-04f,  1.247558594e-04f,
+     2.495117188e-04f,  3.742675781e-04f,  4.990234375e-04f,  6.237792969e-04f,
+     7.485351563e-04f,  8.732910156e-04f,  9.980468750e-04f,  1.122802734e-03f,
+     1.247558594e-03f,  1.372314453e-03f,  1.497070313e-03f,  1.621826172e-03f,
+     1.746582031e-03f,  1.871337891e-03f,  1.996093750e-03f,  1.871337891e-03f,
+     1.746582031e-03f,  1.621826172e-03f,  1.497070313e-03f,  1.372314453e-03f,
+     1.247558594e-03f,  1.122802734e-03f,  9.980468750e-04f,  8.732910156e-04f,
+     7.485351563e-04f,  6.237792969e-04f,  4.990234375e-04f,  3.742675781e-04f,
+     2.495117188e-04f,  1.247558594e-04f,  1.174172794e-04f,  2.348345588e-04f,
+     3.522518382e-04f,  4.696691176e-04f,  5.870863971e-04f,  7.045036765e-04f,
+     8.219209559e-04f,  9.393382353e-04f,  1.056755515e-03f,  1.174172794e-03f,
+     1.291590074e-03f,  1.409007353e-03f,  1.526424632e-03f,  1.643841912e-03f,
+     1.761259191e-03f,  1.878676471e-03f,  1.774305556e-03f,  1.669934641e-03f,
+     1.565563725e-03f,  1.461192810e-03f,  1.356821895e-03f,  1.252450980e-03f,
+     1.148080065e-03f,  1.043709150e-03f,  9.393382353e-04f,  8.349673203e-04f,
+     7.305964052e-04f,  6.262254902e-04f,  5.218545752e-04f,  4.174836601e-04f,
+     3.131127451e-04f,  2.087418301e-04f,  1.043709150e-04f,  9.590840841e-05f,
+     1.918168168e-04f,  2.877252252e-04f,  3.836336336e-04f,  4.795420420e-04f,
+     5.754504505e-04f,  6.713588589e-04f,  7.672672673e-04f,  8.631756757e-04f,
+     9.590840841e-04f,  1.054992492e-03f,  1.150900901e-03f,  1.246809309e-03f,
+     1.342717718e-03f,  1.438626126e-03f,  1.534534535e-03f,  1.630442943e-03f,
+     1.726351351e-03f,  1.635490754e-03f,  1.544630156e-03f,  1.453769559e-03f,
+     1.362908962e-03f,  1.272048364e-03f,  1.181187767e-03f,  1.090327169e-03f,
+     9.994665718e-04f,  9.086059744e-04f,  8.177453770e-04f,  7.268847795e-04f,
+     6.360241821e-04f,  5.451635846e-04f,  4.543029872e-04f,  3.634423898e-04f,
+     2.725817923e-04f,  1.817211949e-04f,  9.086059744e-05f,  8.620107962e-05f,
+     1.724021592e-04f,  2.586032389e-04f,  3.448043185e-04f,  4.310053981e-04f,
+     5.172064777e-04f,  6.034075574e-04f,  6.896086370e-04f,  7.758097166e-04f,
+     8.620107962e-04f,  9.482118758e-04f,  1.034412955e-03f,  1.120614035e-03f,
+     1.206815115e-03f,  1.293016194e-03f,  1.379217274e-03f,  1.465418354e-03f,
+     1.551619433e-03f,  1.637820513e-03f,  1.555929487e-03f,  1.474038462e-03f,
+     1.392147436e-03f,  1.310256410e-03f,  1.228365385e-03f,  1.146474359e-03f,
+     1.064583333e-03f,  9.826923077e-04f,  9.008012821e-04f,  8.189102564e-04f,
+     7.370192308e-04f,  6.551282051e-04f,  5.732371795e-04f,  4.913461538e-04f,
+     4.094551282e-04f,  3.275641026e-04f,  2.456730769e-04f,  1.637820513e-04f,
+     8.189102564e-05f,  7.604166667e-05f,  1.520833333e-04f,  2.281250000e-04f,
+     3.041666667e-04f,  3.802083333e-04f,  4.562500000e-04f,  5.322916667e-04f,
+     6.083333333e-04f,  6.843750000e-04f,  7.604166667e-04f,  8.364583333e-04f,
+     9.125000000e-04f,  9.885416667e-04f,  1.064583333e-03f,  1.140625000e-03f,
+     1.216666667e-03f,  1.292708333e-03f,  1.368750000e-03f,  1.444791667e-03f,
+     1.520833333e-03f,  1.451704545e-03f,  1.382575758e-03f,  1.313446970e-03f,
+     1.244318182e-03f,  1.175189394e-03f,  1.106060606e-03f,  1.036931818e-03f,
+     9.678030303e-04f,  8.986742424e-04f,  8.295454545e-04f,  7.604166667e-04f,
+     6.912878788e-04f,  6.221590909e-04f,  5.530303030e-04f,  4.839015152e-04f,
+     4.147727273e-04f,  3.456439394e-04f,  2.765151515e-04f,  2.073863636e-04f,
+     1.382575758e-04f,  6.912878788e-05f,  6.452020202e-05f,  1.290404040e-04f,
+     1.935606061e-04f,  2.580808081e-04f,  3.226010101e-04f,  3.871212121e-04f,
+     4.516414141e-04f,  5.161616162e-04f,  5.806818182e-04f,  6.452020202e-04f,
+     7.097222222e-04f,  7.742424242e-04f,  8.387626263e-04f,  9.032828283e-04f,
+     9.678030303e-04f,  1.032323232e-03f,  1.096843434e-03f,  1.161363636e-03f,
+     1.225883838e-03f,  1.290404040e-03f,  1.354924242e-03f,  1.419444444e-03f,
+     1.357729469e-03f,  1.296014493e-03f,  1.234299517e-03f,  1.172584541e-03f,
+     1.110869565e-03f,  1.049154589e-03f,  9.874396135e-04f,  9.257246377e-04f,
+     8.640096618e-04f,  8.022946860e-04f,  7.405797101e-04f,  6.788647343e-04f,
+     6.171497585e-04f,  5.554347826e-04f,  4.937198068e-04f,  4.320048309e-04f,
+     3.702898551e-04f,  3.085748792e-04f,  2.468599034e-04f,  1.851449275e-04f,
+     1.234299517e-04f,  6.171497585e-05f,  5.785778986e-05f,  1.157155797e-04f,
+     1.735733696e-04f,  2.314311594e-04f,  2.892889493e-04f,  3.471467391e-04f,
+     4.050045290e-04f,  4.628623188e-04f,  5.207201087e-04f,  5.785778986e-04f,
+     6.364356884e-04f,  6.942934783e-04f,  7.521512681e-04f,  8.100090580e-04f,
+     8.678668478e-04f,  9.257246377e-04f,  9.835824275e-04f,  1.041440217e-03f,
+     1.099298007e-03f,  1.157155797e-03f,  1.215013587e-03f,  1.272871377e-03f,
+     1.330729167e-03f,  1.277500000e-03f,  1.224270833e-03f,  1.171041667e-03f,
+     1.117812500e-03f,  1.064583333e-03f,  1.011354167e-03f,  9.581250000e-04f,
+     9.048958333e-04f,  8.516666667e-04f,  7.984375000e-04f,  7.452083333e-04f,
+     6.919791667e-04f,  6.387500000e-04f,  5.855208333e-04f,  5.322916667e-04f,
+     4.790625000e-04f,  4.258333333e-04f,  3.726041667e-04f,  3.193750000e-04f,
+     2.661458333e-04f,  2.129166667e-04f,  1.596875000e-04f,  1.064583333e-04f,
+     5.322916667e-05f,  5.009803922e-05f,  1.001960784e-04f,  1.502941176e-04f,
+     2.003921569e-04f,  2.504901961e-04f,  3.005882353e-04f,  3.506862745e-04f,
+     4.007843137e-04f,  4.508823529e-04f,  5.009803922e-04f,  5.510784314e-04f,
+     6.011764706e-04f,  6.512745098e-04f,  7.013725490e-04f,  7.514705882e-04f,
+     8.015686275e-04f,  8.516666667e-04f,  9.017647059e-04f,  9.518627451e-04f,
+     1.001960784e-03f,  1.052058824e-03f,  1.102156863e-03f,  1.152254902e-03f,
+     1.202352941e-03f,  1.252450980e-03f,  1.204279789e-03f,  1.156108597e-03f,
+     1.107937406e-03f,  1.059766214e-03f,  1.011595023e-03f,  9.634238311e-04f,
+     9.152526395e-04f,  8.670814480e-04f,  8.189102564e-04f,  7.707390649e-04f,
+     7.225678733e-04f,  6.743966817e-04f,  6.262254902e-04f,  5.780542986e-04f,
+     5.298831071e-04f,  4.817119155e-04f,  4.335407240e-04f,  3.853695324e-04f,
+     3.371983409e-04f,  2.890271493e-04f,  2.408559578e-04f,  1.926847662e-04f,
+     1.445135747e-04f,  9.634238311e-05f,  4.817119155e-05f,  4.549501425e-05f,
+     9.099002849e-05f,  1.364850427e-04f,  1.819800570e-04f,  2.274750712e-04f,
+     2.729700855e-04f,  3.184650997e-04f,  3.639601140e-04f,  4.094551282e-04f,
+     4.549501425e-04f,  5.004451567e-04f,  5.459401709e-04f,  5.914351852e-04f,
+     6.369301994e-04f,  6.824252137e-04f,  7.279202279e-04f,  7.734152422e-04f,
+     8.189102564e-04f,  8.644052707e-04f,  9.099002849e-04f,  9.553952991e-04f,
+     1.000890313e-03f,  1.046385328e-03f,  1.091880342e-03f,  1.137375356e-03f,
+     1.182870370e-03f,  1.140625000e-03f,  1.098379630e-03f,  1.056134259e-03f,
+     1.013888889e-03f,  9.716435185e-04f,  9.293981481e-04f,  8.871527778e-04f,
+     8.449074074e-04f,  8.026620370e-04f,  7.604166667e-04f,  7.181712963e-04f,
+     6.759259259e-04f,  6.336805556e-04f,  5.914351852e-04f,  5.491898148e-04f,
+     5.069444444e-04f,  4.646990741e-04f,  4.224537037e-04f,  3.802083333e-04f,
+     3.379629630e-04f,  2.957175926e-04f,  2.534722222e-04f,  2.112268519e-04f,
+     1.689814815e-04f,  1.267361111e-04f,  8.449074074e-05f,  4.224537037e-05f,
+     3.866525424e-05f,  7.733050847e-05f,  1.159957627e-04f,  1.546610169e-04f,
+     1.933262712e-04f,  2.319915254e-04f,  2.706567797e-04f,  3.093220339e-04f,
+     3.479872881e-04f,  3.866525424e-04f,  4.253177966e-04f,  4.639830508e-04f,
+     5.026483051e-04f,  5.413135593e-04f,  5.799788136e-04f,  6.186440678e-04f,
+     6.573093220e-04f,  6.959745763e-04f,  7.346398305e-04f,  7.733050847e-04f,
+     8.119703390e-04f,  8.506355932e-04f,  8.893008475e-04f,  9.279661017e-04f,
+     9.666313559e-04f,  1.005296610e-03f,  1.043961864e-03f,  1.082627119e-03f,
+     1.047703663e-03f,  1.012780208e-03f,  9.778567523e-04f,  9.429332969e-04f,
+     9.080098414e-04f,  8.730863860e-04f,  8.381629306e-04f,  8.032394751e-04f,
+     7.683160197e-04f,  7.333925642e-04f,  6.984691088e-04f,  6.635456534e-04f,
+     6.286221979e-04f,  5.936987425e-04f,  5.587752870e-04f,  5.238518316e-04f,
+     4.889283762e-04f,  4.540049207e-04f,  4.190814653e-04f,  3.841580098e-04f,
+     3.492345544e-04f,  3.143110990e-04f,  2.793876435e-04f,  2.444641881e-04f,
+     2.095407326e-04f,  1.746172772e-04f,  1.396938218e-04f,  1.047703663e-04f,
+     6.984691088e-05f,  3.492345544e-05f,  3.270609319e-05f,  6.541218638e-05f,
+     9.811827957e-05f,  1.308243728e-04f,  1.635304659e-04f,  1.962365591e-04f,
+     2.289426523e-04f,  2.616487455e-04f,  2.943548387e-04f,  3.270609319e-04f,
+     3.597670251e-04f,  3.924731183e-04f,  4.251792115e-04f,  4.578853047e-04f,
+     4.905913978e-04f,  5.232974910e-04f,  5.560035842e-04f,  5.887096774e-04f,
+     6.214157706e-04f,  6.541218638e-04f,  6.868279570e-04f,  7.195340502e-04f,
+     7.522401434e-04f,  7.849462366e-04f,  8.176523297e-04f,  8.503584229e-04f,
+     8.830645161e-04f,  9.157706093e-04f,  9.484767025e-04f,  9.811827957e-04f,
+     1.013888889e-03f,  9.822048611e-04f,  9.505208333e-04f,  9.188368056e-04f,
+     8.871527778e-04f,  8.554687500e-04f,  8.237847222e-04f,  7.921006944e-04f,
+     7.604166667e-04f,  7.287326389e-04f,  6.970486111e-04f,  6.653645833e-04f,
+     6.336805556e-04f,  6.019965278e-04f,  5.703125000e-04f,  5.386284722e-04f,
+     5.069444444e-04f,  4.752604167e-04f,  4.435763889e-04f,  4.118923611e-04f,
+     3.802083333e-04f,  3.485243056e-04f,  3.168402778e-04f,  2.851562500e-04f,
+     2.534722222e-04f,  2.217881944e-04f,  1.901041667e-04f,  1.584201389e-04f,
+     1.267361111e-04f,  9.505208333e-05f,  6.336805556e-05f,  3.168402778e-05f
+};
+
+/* Largest weight of each Mel band */
+
+const float32_t DSPTables_filterbankMaxima[40] __attribute__((aligned(8))) = {
+     1.277500000e-02f,  1.277500000e-02f,  1.277500000e-02f,  1.064583333e-02f,
+     1.064583333e-02f,  1.064583333e-02f,  9.125000000e-03f,  7.984375000e-03f,
+     7.984375000e-03f,  7.984375000e-03f,  7.097222222e-03f,  7.097222222e-03f,
+     6.387500000e-03f,  5.806818182e-03f,  5.806818182e-03f,  4.913461538e-03f,
+     4.562500000e-03f,  4.562500000e-03f,  4.258333333e-03f,  3.757352941e-03f,
+     3.548611111e-03f,  3.548611111e-03f,  3.193750000e-03f,  2.903409091e-03f,
+     2.777173913e-03f,  2.661458333e-03f,  2.456730769e-03f,  2.281250000e-03f,
+     2.129166667e-03f,  1.996093750e-03f,  1.878676471e-03f,  1.726351351e-03f,
+     1.637820513e-03f,  1.520833333e-03f,  1.419444444e-03f,  1.330729167e-03f,
+     1.252450980e-03f,  1.182870370e-03f,  1.082627119e-03f,  1.013888889e-03f
+};
+
+/* Weights of the Mel bands relative to the band maximum in Q31 */
+
+const q31_t DSPTables_filterbankWeightsQ31[860] __attribute__((aligned(8))) = {
+     1073741824,  2147483647,  1431655765,   715827883,
+      715827883,  1431655765,  2147483647,  1073741824,
+     1073741824,  2147483647,  1431655765,   715827883,
+      715827883,  1431655765,  2147483647,  1431655765,
+      715827883,   715827883,  1431655765,  2147483647,
+     1431655765,   715827883,   715827883,  1431655765,
+     2147483647,  1431655765,   715827883,   715827883,
+     1431655765,  2147483647,  1610612736,  1073741824,
+      536870912,   536870912,  1073741824,  1610612736,
+     2147483647,  1610612736,  1073741824,   536870912,
+      536870912,  1073741824,  1610612736,  2147483647,
+     1610612736,  1073741824,   536870912,   536870912,
+     1073741824,  1610612736,  2147483647,  1610612736,
+     1073741824,   536870912,   536870912,  1073741824,
+     1610612736,  2147483647,  1717986918,  1288490189,
+      858993459,   429496730,   429496730,   858993459,
+     1288490189,  1717986918,  2147483647,  1610612736,
+     1073741824,   536870912,   536870912,  1073741824,
+     1610612736,  2147483647,  1789569707,  1431655765,
+     1073741824,   715827883,   357913941,   357913941,
+      715827883,  1073741824,  1431655765,  1789569707,
+     2147483647,  1717986918,  1288490189,   858993459,
+      429496730,   429496730,   858993459,  1288490189,
+     1717986918,  2147483647,  1789569707,  1431655765,
+     1073741824,   715827883,   357913941,   357913941,
+      715827883,  1073741824,  1431655765,  1789569707,
+     2147483647,  1840700270,  1533916891,  1227133513,
+      920350135,   613566757,   306783378,   306783378,
+      613566757,   920350135,  1227133513,  1533916891,
+     1840700270,  2147483647,  1840700270,  1533916891,
+     1227133513,   920350135,   613566757,   306783378,
+      306783378,   613566757,   920350135,  1227133513,
+     1533916891,  1840700270,  2147483647,  1840700270,
+     1533916891,  1227133513,   920350135,   613566757,
+      306783378,   306783378,   613566757,   920350135,
+     1227133513,  1533916891,  1840700270,  2147483647,
+     1879048192,  1610612736,  1342177280,  1073741824,
+      805306368,   536870912,   268435456,   268435456,
+      536870912,   805306368,  1073741824,  1342177280,
+     1610612736,  1879048192,  2147483647,  1908874354,
+     1670265060,  1431655765,  1193046471,   954437177,
+      715827883,   477218588,   238609294,   238609294,
+      477218588,   715827883,   954437177,  1193046471,
+     1431655765,  1670265060,  1908874354,  2147483647,
+     1908874354,  1670265060,  1431655765,  1193046471,
+      954437177,   715827883,   477218588,   238609294,
+      238609294,   477218588,   715827883,   954437177,
+     1193046471,  1431655765,  1670265060,  1908874354,
+     2147483647,  1908874354,  1670265060,  1431655765,
+     1193046471,   954437177,   715827883,   477218588,
+      238609294,   238609294,   477218588,   715827883,
+      954437177,  1193046471,  1431655765,  1670265060,
+     1908874354,  2147483647,  1952257862,  1757032076,
+     1561806289,  1366580503,  1171354717,   976128931,
+      780903145,   585677359,   390451572,   195225786,
+      195225786,   390451572,   585677359,   780903145,
+      976128931,  1171354717,  1366580503,  1561806289,
+     1757032076,  1952257862,  2147483647,  1952257862,
+     1757032076,  1561806289,  1366580503,  1171354717,
+      976128931,   780903145,   585677359,   390451572,
+      195225786,   195225786,   390451572,   585677359,
+      780903145,   976128931,  1171354717,  1366580503,
+     1561806289,  1757032076,  1952257862,  2147483647,
+     1968526677,  1789569707,  1610612736,  1431655765,
+     1252698795,  1073741824,   894784853,   715827883,
+      536870912,   357913941,   178956971,   178956971,
+      357913941,   536870912,   715827883,   894784853,
+     1073741824,  1252698795,  1431655765,  1610612736,
+     1789569707,  1968526677,  2147483647,  1968526677,
+     1789569707,  1610612736,  1431655765,  1252698795,
+     1073741824,   894784853,   715827883,   536870912,
+      357913941,   178956971,   178956971,   357913941,
+      536870912,   715827883,   894784853,  1073741824,
+     1252698795,  1431655765,  1610612736,  1789569707,
+     1968526677,  2147483647,  1994091959,  1840700270,
+     1687308581,  1533916891,  1380525202,  1227133513,
+     1073741824,   920350135,   766958446,   613566757,
+      460175067,   306783378,   153391689,   153391689,
+      306783378,   460175067,   613566757,   766958446,
+      920350135,  1073741824,  1227133513,  1380525202,
+     1533916891,  1687308581,  1840700270,  1994091959,
+     2147483647,  1994091959,  1840700270,  1687308581,
+     1533916891,  1380525202,  1227133513,  1073741824,
+      920350135,   766958446,   613566757,   460175067,
+      306783378,   153391689,   153391689,   306783378,
+      460175067,   613566757,   766958446,   920350135,
+     1073741824,  1227133513,  1380525202,  1533916891,
+     1687308581,  1840700270,  1994091959,  2147483647,
+     2013265920,  1879048192,  1744830464,  1610612736,
+     1476395008,  1342177280,  1207959552,  1073741824,
+      939524096,   805306368,   671088640,   536870912,
+      402653184,   268435456,   134217728,   134217728,
+      268435456,   402653184,   536870912,   671088640,
+      805306368,   939524096,  1073741824,  1207959552,
+     1342177280,  1476395008,  1610612736,  1744830464,
+     1879048192,  2013265920,  2147483647,  2013265920,
+     1879048192,  1744830464,  1610612736,  1476395008,
+     1342177280,  1207959552,  1073741824,   939524096,
+      805306368,   671088640,   536870912,   402653184,
+      268435456,   134217728,   134217728,   268435456,
+      402653184,   536870912,   671088640,   805306368,
+      939524096,  1073741824,  1207959552,  1342177280,
+     1476395008,  1610612736,  1744830464,  1879048192,
+     2013265920,  2147483647,  2028179001,  1908874354,
+     1789569707,  1670265060,  1550960412,  1431655765,
+     1312351118,  1193046471,  1073741824,   954437177,
+      835132530,   715827883,   596523236,   477218588,
+      357913941,   238609294,   119304647,   119304647,
+      238609294,   357913941,   477218588,   596523236,
+      715827883,   835132530,   954437177,  1073741824,
+     1193046471,  1312351118,  1431655765,  1550960412,
+     1670265060,  1789569707,  1908874354,  2028179001,
+     2147483647,  2034458193,  1921432738,  1808407283,
+     1695381827,  1582356372,  1469330917,  1356305462,
+     1243280007,  1130254552,  1017229096,   904203641,
+      791178186,   678152731,   565127276,   452101821,
+      339076365,   226050910,   113025455,   113025455,
+      226050910,   339076365,   452101821,   565127276,
+      678152731,   791178186,   904203641,  1017229096,
+     1130254552,  1243280007,  1356305462,  1469330917,
+     1582356372,  1695381827,  1808407283,  1921432738,
+     2034458193,  2147483647,  2040109466,  1932735283,
+     1825361101,  1717986918,  1610612736,  1503238554,
+     1395864371,  1288490189,  1181116006,  1073741824,
+      966367642,   858993459,   751619277,   644245094,
+      536870912,   429496730,   322122547,   214748365,
+      107374182,   107374182,   214748365,   322122547,
+      429496730,   536870912,   644245094,   751619277,
+      858993459,   966367642,  1073741824,  1181116006,
+     1288490189,  1395864371,  1503238554,  1610612736,
+     1717986918,  1825361101,  1932735283,  2040109466,
+     2147483647,  2049870755,  1952257862,  1854644969,
+     1757032076,  1659419183,  1561806289,  1464193396,
+     1366580503,  1268967610,  1171354717,  1073741824,
+      976128931,   878516038,   780903145,   683290252,
+      585677359,   488064465,   390451572,   292838679,
+      195225786,    97612893,    97612893,   195225786,
+      292838679,   390451572,   488064465,   585677359,
+      683290252,   780903145,   878516038,   976128931,
+     1073741824,  1171354717,  1268967610,  1366580503,
+     1464193396,  1561806289,  1659419183,  1757032076,
+     1854644969,  1952257862,  2049870755,  2147483647,
+     2054114794,  1960745939,  1867377085,  1774008231,
+     1680639377,  1587270522,  1493901668,  1400532814,
+     1307163960,  1213795105,  1120426251,  1027057397,
+      933688543,   840319688,   746950834,   653581980,
+      560213126,   466844271,   373475417,   280106563,
+      186737709,    93368854,    93368854,   186737709,
+      280106563,   373475417,   466844271,   560213126,
+      653581980,   746950834,   840319688,   933688543,
+     1027057397,  1120426251,  1213795105,  1307163960,
+     1400532814,  1493901668,  1587270522,  1680639377,
+     1774008231,  1867377085,  1960745939,  2054114794,
+     2147483647,  2061584302,  1975684956,  1889785610,
+     1803886264,  1717986918,  1632087572,  1546188227,
+     1460288881,  1374389535,  1288490189,  1202590843,
+     1116691497,  1030792151,   944892805,   858993459,
+      773094113,   687194767,   601295421,   515396076,
+      429496730,   343597384,   257698038,   171798692,
+       85899346,    85899346,   171798692,   257698038,
+      343597384,   429496730,   515396076,   601295421,
+      687194767,   773094113,   858993459,   944892805,
+     1030792151,  1116691497,  1202590843,  1288490189,
+     1374389535,  1460288881,  1546188227,  1632087572,
+     1717986918,  1803886264,  1889785610,  1975684956,
+     2061584302,  2147483647,  2064888123,  1982292598,
+     1899697073,  1817101548,  1734506023,  1651910498,
+     1569314974,  1486719449,  1404123924,  1321528399,
+     1238932874,  1156337349,  1073741824,   991146299,
+      908550774,   825955249,   743359724,   660764199,
+      578168674,   495573150,   412977625,   330382100,
+      247786575,   165191050,    82595525,    82595525,
+      165191050,   247786575,   330382100,   412977625,
+      495573150,   578168674,   660764199,   743359724,
+      825955249,   908550774,   991146299,  1073741824,
+     1156337349,  1238932874,  1321528399,  1404123924,
+     1486719449,  1569314974,  1651910498,  1734506023,
+     1817101548,  1899697073,  1982292598,  2064888123,
+     2147483647,  2070787803,  1994091959,  1917396114,
+     1840700270,  1764004425,  1687308581,  1610612736,
+     1533916891,  1457221047,  1380525202,  1303829358,
+     1227133513,  1150437669,  1073741824,   997045979,
+      920350135,   843654290,   766958446,   690262601,
+      613566757,   536870912,   460175067,   383479223,
+      306783378,   230087534,   153391689,    76695845,
+       76695845,   153391689,   230087534,   306783378,
+      383479223,   460175067,   536870912,   613566757,
+      690262601,   766958446,   843654290,   920350135,
+      997045979,  1073741824,  1150437669,  1227133513,
+     1303829358,  1380525202,  1457221047,  1533916891,
+     1610612736,  1687308581,  1764004425,  1840700270,
+     1917396114,  1994091959,  2070787803,  2147483647,
+     2078209982,  2008936316,  1939662650,  1870388984,
+     1801115318,  1731841652,  1662567986,  1593294319,
+     1524020653,  1454746987,  1385473321,  1316199655,
+     1246925989,  1177652323,  1108378657,  1039104991,
+      969831325,   900557659,   831283993,   762010327,
+      692736661,   623462995,   554189329,   484915662,
+      415641996,   346368330,   277094664,   207820998,
+      138547332,    69273666,    69273666,   138547332,
+      207820998,   277094664,   346368330,   415641996,
+      484915662,   554189329,   623462995,   692736661,
+      762010327,   831283993,   900557659,   969831325,
+     1039104991,  1108378657,  1177652323,  1246925989,
+     1316199655,  1385473321,  1454746987,  1524020653,
+     1593294319,  1662567986,  1731841652,  1801115318,
+     1870388984,  1939662650,  2008936316,  2078209982,
+     2147483647,  2080374784,  2013265920,  1946157056,
+     1879048192,  1811939328,  1744830464,  1677721600,
+     1610612736,  1543503872,  1476395008,  1409286144,
+     1342177280,  1275068416,  1207959552,  1140850688,
+     1073741824,  1006632960,   939524096,   872415232,
+      805306368,   738197504,   671088640,   603979776,
+      536870912,   469762048,   402653184,   335544320,
+      268435456,   201326592,   134217728,    67108864
+};
+
+/* Tansig of the requantised accumulators of the int8 network, from the most negative input */
+
+const q7_t DSPTables_tansigQ7[256] __attribute__((aligned(8))) = {
+    -128, -128, -128, -128, -128, -128, -128, -128, -128, -128, -128, -128, -128, -128, -128, -128,
+    -128, -128, -128, -128, -128, -128, -128, -128, -128, -128, -128, -128, -128, -127, -127, -127,
+    -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -126, -126,
+    -126, -126, -126, -126, -126, -126, -126, -125, -125, -125, -125, -125, -124, -124, -124, -124,
+    -123, -123, -123, -122, -122, -122, -121, -121, -120, -120, -120, -119, -118, -118, -117, -117,
+    -116, -115, -114, -113, -113, -112, -111, -110, -109, -107, -106, -105, -104, -102, -101,  -99,
+     -97,  -96,  -94,  -92,  -90,  -88,  -86,  -84,  -81,  -79,  -76,  -74,  -71,  -68,  -65,  -62,
+     -59,  -56,  -53,  -49,  -46,  -42,  -39,  -35,  -31,  -28,  -24,  -20,  -16,  -12,   -8,   -4,
+       0,    4,    8,   12,   16,   20,   24,   28,   31,   35,   39,   42,   46,   49,   53,   56,
+      59,   62,   65,   68,   71,   74,   76,   79,   81,   84,   86,   88,   90,   92,   94,   96,
+      97,   99,  101,  102,  104,  105,  106,  107,  109,  110,  111,  112,  113,  113,  114,  115,
+     116,  117,  117,  118,  118,  119,  120,  120,  120,  121,  121,  122,  122,  122,  123,  123,
+     123,  124,  124,  124,  124,  125,  125,  125,  125,  125,  126,  126,  126,  126,  126,  126,
+     126,  126,  126,  127,  127,  127,  127,  127,  127,  127,  127,  127,  127,  127,  127,  127,
+     127,  127,  127,  127,  127,  127,  127,  127,  127,  127,  127,  127,  127,  127,  127,  127,
+     127,  127,  127,  127,  127,  127,  127,  127,  127,  127,  127,  127,  127,  127,  127,  127
+};
+
+/* Exponential of minus the distance of each requantised logit to the largest one */
+
+const uint16_t DSPTables_softmaxExponential[256] __attribute__((aligned(8))) = {
+    65535, 63519, 61564, 59670, 57834, 56055, 54330, 52659,
+    51039, 49468, 47946, 46471, 45042, 43656, 42313, 41011,
+    39749, 38526, 37341, 36192, 35078, 33999, 32953, 31939,
+    30957, 30004, 29081, 28186, 27319, 26479, 25664, 24874,
+    24109, 23367, 22648, 21951, 21276, 20622, 19987, 19372,
+    18776, 18198, 17639, 17096, 16570, 16060, 15566, 15087,
+    14623, 14173, 13737, 13314, 12905, 12508, 12123, 11750,
+    11388, 11038, 10698, 10369, 10050,  9741,  9441,  9151,
+     8869,  8596,  8332,  8075,  7827,  7586,  7353,  7127,
+     6907,  6695,  6489,  6289,  6096,  5908,  5726,  5550,
+     5379,  5214,  5054,  4898,  4747,  4601,  4460,  4323,
+     4190,  4061,  3936,  3815,  3697,  3583,  3473,  3366,
+     3263,  3162,  3065,  2971,  2879,  2791,  2705,  2622,
+     2541,  2463,  2387,  2314,  2242,  2173,  2107,  2042,
+     1979,  1918,  1859,  1802,  1746,  1693,  1641,  1590,
+     1541,  1494,  1448,  1403,  1360,  1318,  1278,  1238,
+     1200,  1163,  1128,  1093,  1059,  1027,   995,   964,
+      935,   906,   878,   851,   825,   800,   775,   751,
+      728,   706,   684,   663,   642,   623,   604,   585,
+      567,   550,   533,   516,   500,   485,   470,   456,
+      442,   428,   415,   402,   390,   378,   366,   355,
+      344,   333,   323,   313,   303,   294,   285,   276,
+      268,   260,   252,   244,   236,   229,   222,   215,
+      209,   202,   196,   190,   184,   178,   173,   168,
+      162,   157,   153,   148,   143,   139,   135,   131,
+      127,   123,   119,   115,   112,   108,   105,   102,
+       99,    95,    93,    90,    87,    84,    82,    79,
+       77,    74,    72,    70,    68,    66,    64,    62,
+       60,    58,    56,    54,    53,    51,    50,    48,
+       47,    45,    44,    42,    41,    40,    39,    37,
+       36,    35,    34,    33,    32,    31,    30,    29,
+       28,    27,    27,    26,    25,    24,    23,    23
+};
+
+/* Hyperbolic tangent of the float network activations, both ends of the range included */
+
+const float32_t DSPTables_tanh[257] __attribute__((aligned(8))) = {
+     0.000000000e+00f,  3.123983145e-02f,  6.241874675e-02f,  9.347630397e-02f,
+     1.243530018e-01f,  1.549907304e-01f,  1.853331999e-01f,  2.153263397e-01f,
+     2.449186624e-01f,  2.740615890e-01f,  3.027097293e-01f,  3.308211175e-01f,
+     3.583573984e-01f,  3.852839663e-01f,  4.115700557e-01f,  4.371887851e-01f,
+     4.621171573e-01f,  4.863360172e-01f,  5.098299737e-01f,  5.325872862e-01f,
+     5.545997223e-01f,  5.758623913e-01f,  5.963735555e-01f,  6.161344271e-01f,
+     6.351489524e-01f,  6.534235881e-01f,  6.709670742e-01f,  6.877902051e-01f,
+     7.039056039e-01f,  7.193275010e-01f,  7.340715196e-01f,  7.481544703e-01f,
+     7.615941560e-01f,  7.744091874e-01f,  7.866188121e-01f,  7.982427545e-01f,
+     8.093010702e-01f,  8.198140121e-01f,  8.298019100e-01f,  8.392850624e-01f,
+     8.482836400e-01f,  8.568176011e-01f,  8.649066177e-01f,  8.725700115e-01f,
+     8.798266997e-01f,  8.866951494e-01f,  8.931933404e-01f,  8.993387348e-01f,
+     9.051482536e-01f,  9.106382595e-01f,  9.158245442e-01f,  9.207223218e-01f,
+     9.253462253e-01f,  9.297103072e-01f,  9.338280432e-01f,  9.377123389e-01f,
+     9.413755385e-01f,  9.448294355e-01f,  9.480852856e-01f,  9.511538199e-01f,
+     9.540452602e-01f,  9.567693345e-01f,  9.593352933e-01f,  9.617519265e-01f,
+     9.640275801e-01f,  9.661701735e-01f,  9.681872166e-01f,  9.700858268e-01f,
+     9.718727459e-01f,  9.735543565e-01f,  9.751366983e-01f,  9.766254840e-01f,
+     9.780261147e-01f,  9.793436950e-01f,  9.805830470e-01f,  9.817487252e-01f,
+     9.828450292e-01f,  9.838760169e-01f,  9.848455175e-01f,  9.857571425e-01f,
+     9.866142982e-01f,  9.874201957e-01f,  9.881778623e-01f,  9.888901506e-01f,
+     9.895597486e-01f,  9.901891886e-01f,  9.907808556e-01f,  9.913369960e-01f,
+     9.918597246e-01f,  9.923510327e-01f,  9.928127948e-01f,  9.932467752e-01f,
+     9.936546343e-01f,  9.940379345e-01f,  9.943981461e-01f,  9.947366521e-01f,
+     9.950547537e-01f,  9.953536750e-01f,  9.956345671e-01f,  9.958985129e-01f,
+     9.961465307e-01f,  9.963795779e-01f,  9.965985552e-01f,  9.968043090e-01f,
+     9.969976355e-01f,  9.971792830e-01f,  9.973499552e-01f,  9.975103134e-01f,
+     9.976609795e-01f,  9.978025379e-01f,  9.979355379e-01f,  9.980604961e-01f,
+     9.981778976e-01f,  9.982881987e-01f,  9.983918281e-01f,  9.984891887e-01f,
+     9.985806592e-01f,  9.986665954e-01f,  9.987473317e-01f,  9.988231824e-01f,
+     9.988944427e-01f,  9.989613903e-01f,  9.990242858e-01f,  9.990833742e-01f,
+     9.991388858e-01f,  9.991910370e-01f,  9.992400310e-01f,  9.992860587e-01f,
+     9.993292997e-01f,  9.993699226e-01f,  9.994080858e-01f,  9.994439381e-01f,
+     9.994776194e-01f,  9.995092610e-01f,  9.995389866e-01f,  9.995669119e-01f,
+     9.995931460e-01f,  9.996177914e-01f,  9.996409441e-01f,  9.996626945e-01f,
+     9.996831276e-01f,  9.997023230e-01f,  9.997203558e-01f,  9.997372964e-01f,
+     9.997532108e-01f,  9.997681613e-01f,  9.997822062e-01f,  9.997954003e-01f,
+     9.998077952e-01f,  9.998194392e-01f,  9.998303779e-01f,  9.998406540e-01f,
+     9.998503075e-01f,  9.998593763e-01f,  9.998678957e-01f,  9.998758990e-01f,
+     9.998834175e-01f,  9.998904805e-01f,  9.998971156e-01f,  9.999033487e-01f,
+     9.999092043e-01f,  9.999147051e-01f,  9.999198726e-01f,  9.999247271e-01f,
+     9.999292875e-01f,  9.999335716e-01f,  9.999375962e-01f,  9.999413769e-01f,
+     9.999449286e-01f,  9.999482651e-01f,  9.999513995e-01f,  9.999543440e-01f,
+     9.999571101e-01f,  9.999597086e-01f,  9.999621497e-01f,  9.999644429e-01f,
+     9.999665972e-01f,  9.999686209e-01f,  9.999705220e-01f,  9.999723080e-01f,
+     9.999739857e-01f,  9.999755618e-01f,  9.999770425e-01f,  9.999784334e-01f,
+     9.999797400e-01f,  9.999809675e-01f,  9.999821206e-01f,  9.999832039e-01f,
+     9.999842215e-01f,  9.999851774e-01f,  9.999860755e-01f,  9.999869191e-01f,
+     9.999877117e-01f,  9.999884562e-01f,  9.999891556e-01f,  9.999898126e-01f,
+     9.999904298e-01f,  9.999910096e-01f,  9.999915543e-01f,  9.999920660e-01f,
+     9.999925467e-01f,  9.999929983e-01f,  9.999934225e-01f,  9.999938210e-01f,
+     9.999941954e-01f,  9.999945471e-01f,  9.999948774e-01f,  9.999951878e-01f,
+     9.999954794e-01f,  9.999957532e-01f,  9.999960105e-01f,  9.999962522e-01f,
+     9.999964793e-01f,  9.999966926e-01f,  9.999968930e-01f,  9.999970812e-01f,
+     9.999972581e-01f,  9.999974242e-01f,  9.999975803e-01f,  9.999977269e-01f,
+     9.999978646e-01f,  9.999979940e-01f,  9.999981155e-01f,  9.999982297e-01f,
+     9.999983369e-01f,  9.999984377e-01f,  9.999985324e-01f,  9.999986213e-01f,
+     9.999987048e-01f,  9.999987833e-01f,  9.999988570e-01f,  9.999989262e-01f,
+     9.999989913e-01f,  9.999990524e-01f,  9.999991098e-01f,  9.999991638e-01f,
+     9.999992144e-01f,  9.999992620e-01f,  9.999993067e-01f,  9.999993487e-01f,
+     9.999993882e-01f,  9.999994253e-01f,  9.999994601e-01f,  9.999994928e-01f,
+     9.999995235e-01f,  9.999995524e-01f,  9.999995795e-01f,  9.999996050e-01f,
+     9.999996289e-01f,  9.999996514e-01f,  9.999996725e-01f,  9.999996924e-01f,
+     9.999997110e-01f,  9.999997285e-01f,  9.999997450e-01f,  9.999997604e-01f,
+     9.999997749e-01f
+};
+
@@ -0,0 +1,201 @@
+/****************************************************************************
+ * fastmath.c
+ * openacousticdevices.info
+ * October 2026
+ *****************************************************************************/
+
+#include <math.h>
+#include <stdint.h>
+
+#include "fastmath.h"
+
+/* Floating point format constants */
+
+#define FLOAT_EXPONENT_BIAS                     127
+#define FLOAT_MANTISSA_BITS                     23
+#define FLOAT_MANTISSA_MASK                     0x007FFFFF
+#define FLOAT_EXPONENT_OF_ONE                   0x3F800000
+#define FLOAT_SMALLEST_NORMAL                   0x00800000
+#define FLOAT_INFINITY                          0x7F800000
+#define FLOAT_SUBNORMAL_SCALE                   8388608.0f
+
+/* Logarithm constants */
+
+#define SQRT_2                                  1.41421356237f
+#define LOG10_E                                 0.434294481903f
+#define LOG10_2_HI                              0.30102539062f
+#define LOG10_2_LO                              4.6050389811e-6f
+
+/* Exponential constants */
+
+#define EXP_MAXIMUM_INPUT                       88.7228391117f
+#define EXP_MINIMUM_INPUT                       -87.3365447506f
+#define LOG2_E                                  1.44269504089f
+#define LN_2_HI                                 0.693145751953f
+#define LN_2_LO                                 1.42860682030e-6f
+
+/* Type punning between float and its bit pattern */
+
+typedef union {
+    float32_t f;
+    uint32_t u;
+} floatBits_t;
+
+/* 
+ * Function: FastMath_log10f
+ * Purpose: Single-precision base 10 logarithm.
+ * 
+ * Steps:
+ * 1. Split x into 2^e * m with m in [sqrt(1/2), sqrt(2)].
+ * 2. Evaluate ln(m) = 2 * atanh(s), s = (m - 1) / (m + 1), as an odd
+ *    polynomial in s (|s| < 0.172, so the series converges to float precision
+ *    with four terms).
+ * 3. Combine as e * log10(2) + ln(m) * log10(e).
+ */
+float32_t FastMath_log10f(float32_t x) {
+
+    floatBits_t v = {.f = x};
+
+    if (!(x > 0.0f)) return x == 0.0f ? -INFINITY : NAN;
+
+    if (v.u >= FLOAT_INFINITY) return x;
+
+    int32_t exponent = 0;
+
+    if (v.u < FLOAT_SMALLEST_NORMAL) {
+
+        v.f = x * FLOAT_SUBNORMAL_SCALE;
+
+        exponent = -FLOAT_MANTISSA_BITS;
+
+    }
+
+    exponent += (int32_t)(v.u >> FLOAT_MANTISSA_BITS) - FLOAT_EXPONENT_BIAS;
+
+    v.u = (v.u & FLOAT_MANTISSA_MASK) | FLOAT_EXPONENT_OF_ONE;
+
+    if (v.f > SQRT_2) {
+
+        v.f *= 0.5f;
+
+        exponent += 1;
+
+    }
+
+    float32_t s = (v.f - 1.0f) / (v.f + 1.0f);
+
+    float32_t s2 = s * s;
+
+    float32_t lnm = 2.0f * s * (1.0f + s2 * (1.0f / 3.0f + s2 * (1.0f / 5.0f + s2 * (1.0f / 7.0f))));
+
+    float32_t e = (float32_t)exponent;
+
+    return e * LOG10_2_HI + (e * LOG10_2_LO + lnm * LOG10_E);
+
+}
+
+/* 
+ * Function: FastMath_expf
+ * Purpose: Single-precision natural exponential.
+ * 
+ * Steps:
+ * 1. Reduce x = k * ln(2) + r with |r| <= ln(2) / 2, using a two-part ln(2)
+ *    so that the reduction is exact for the whole input range.
+ * 2. Evaluate exp(r) with a degree 6 Taylor polynomial (truncation error
+ *    below 1.2e-7 relative).
+ * 3. Scale by 2^k by building the exponent field directly.
+ */
+float32_t FastMath_expf(float32_t x) {
+
+    if (x != x) return x;
+
+    if (x > EXP_MAXIMUM_INPUT) return INFINITY;
+
+    if (x < EXP_MINIMUM_INPUT) return 0.0f;
+
+    int32_t k = (int32_t)(x * LOG2_E + (x >= 0.0f ? 0.5f : -0.5f));
+
+    float32_t r = (x - (float32_t)k * LN_2_HI) - (float32_t)k * LN_2_LO;
+
+    float32_t p = 1.0f + r * (1.0f + r * (1.0f / 2.0f + r * (1.0f / 6.0f + r * (1.0f / 24.0f + r * (1.0f / 120.0f + r * (1.0f / 720.0f))))));
+
+    floatBits_t scale;
+
+    if (k > FLOAT_EXPONENT_BIAS) {
+
+        scale.u = (uint32_t)(k - 1 + FLOAT_EXPONENT_BIAS) << FLOAT_MANTISSA_BITS;
+
+        return 2.0f * p * scale.f;
+
+    }
+
+    scale.u = (uint32_t)(k + FLOAT_EXPONENT_BIAS) << FLOAT_MANTISSA_BITS;
+
+    return p * scale.f;
+
+}
+
+/* Vector functions, unrolled by four as in CMSIS-DSP so that the loop overhead is paid once per
+ * four elements and the independent evaluations can be interleaved by the compiler */
+
+void FastMath_vlog10_f32(const float32_t *pSrc, float32_t *pDst, uint32_t blockSize) {
+
+    uint32_t blockCount = blockSize >> 2;
+
+    while (blockCount > 0) {
+
+        pDst[0] = FastMath_log10f(pSrc[0]);
+        pDst[1] = FastMath_log10f(pSrc[1]);
+        pDst[2] = FastMath_log10f(pSrc[2]);
+        pDst[3] = FastMath_log10f(pSrc[3]);
+
+        pSrc += 4;
+
+        pDst += 4;
+
+        blockCount -= 1;
+
+    }
+
+    blockCount = blockSize & 3;
+
+    while (blockCount > 0) {
+
+        *pDst++ = FastMath_log10f(*pSrc++);
+
+        blockCount -= 1;
+
+    }
+
+}
+
+void FastMath_vexp_f32(const float32_t *pSrc, float32_t *pDst, uint32_t blockSize) {
+
+    uint32_t blockCount = blockSize >> 2;
+
+    while (blockCount > 0) {
+
+        pDst[0] = FastMath_expf(pSrc[0]);
+        pDst[1] = FastMath_expf(pSrc[1]);
+        pDst[2] = FastMath_expf(pSrc[2]);
+        pDst[3] = FastMath_expf(pSrc[3]);
+
+        pSrc += 4;
+
+        pDst += 4;
+
+        blockCount -= 1;
+
+    }
+
+    blockCount = blockSize & 3;
+
+    while (blockCount > 0) {
+
+        *pDst++ = FastMath_expf(*pSrc++);
+
+        blockCount -= 1;
+
+    }
+
+}
@@ -26,6 +26,11 @@
 //#include "math.h"
 #include "arm_math.h"
 
+#include "detector.h"
+#include "nnmodel.h"
+#include "profiler.h"
+#include "detectionlog.h"
+
 /* Useful time constants */
 
 #define MILLISECONDS_IN_SECOND                  1000
@@ -82,13 +87,12 @@
 #define NUMBER_OF_BUFFERS_IN_SUPERBUFFER	(NUMBER_OF_BUFFERS / NUMBER_OF_SUPERBUFFERS)
 #define NUMBER_OF_SAMPLES_IN_SUPERBUFFER	NUMBER_OF_SAMPLES_IN_BUFFER * NUMBER_OF_BUFFERS_IN_SUPERBUFFER
 
-#define NUMBER_OF_BUFFERS_MFCC              5
-#define NUMBER_OF_SAMPLES_IN_BUFFERS_MFCC	12
-#define NBANKS								41
 #define INIT_COUNTDOWN						1230
 //#define THRESHOLD_DETECTION					0.5f
 
-#define MAX_INT_VALUE						32767
+#if NUMBER_OF_SAMPLES_IN_BUFFER != NUMBER_OF_SAMPLES_IN_FRAME
+#error "Each SRAM buffer must hold exactly one detector frame"
+#endif
 // <---
 
 /* DMA transfer constant */
@@ -333,23 +337,58 @@ static wavHeader_t wavHeader = {
 };
 
 /* ---> Introduced: for Lesser Kestrel recognition */
-static float32_t* buffersMFCC[NUMBER_OF_BUFFERS_MFCC];
-static float32_t MK4[NUMBER_OF_SAMPLES_IN_BUFFERS_MFCC];
-static float32_t MK3[NUMBER_OF_SAMPLES_IN_BUFFERS_MFCC];
-static float32_t MK1[NUMBER_OF_SAMPLES_IN_BUFFERS_MFCC];
-static float32_t MK0[NUMBER_OF_SAMPLES_IN_BUFFERS_MFCC];
+static detectorArena_t detectorArena;
+
+static nnModel_t neuralNetworkModel;
+
+static uint32_t neuralNetworkModelImage[NN_MODEL_MAXIMUM_SIZE / sizeof(uint32_t)];
+
+static bool neuralNetworkModelLoaded = false;
+
+static nnModel_t confirmerModel;                // Cascade: confirms the frames passed by neuralNetworkModel
+
+static uint32_t confirmerModelImage[NN_MODEL_MAXIMUM_SIZE / sizeof(uint32_t)];
+
+static bool cascadeEnabled = false;             // Set when NN_CONFIRM.bin is loaded
+
+static detectionLog_t detectionLog;             // Detections waiting to be appended to calls.txt
+
+static detectionLogHeader_t detectionLogHeader; // Written to calls.bin before the first detections of a recording
+
+static bool detectionLogHeaderPending = false;
 
 void writeLog(char * str);
+bool writeDetections(uint32_t maximumNumberOfWrites);
+#ifdef ENABLE_PROFILING
+void writeProfile(char *filename);
+#endif
 float parseFloat(const char *str);
 void LoadNNConfig(void);
-static void MFCC(int16_t *bufferIN, float32_t *bufferOUT, uint32_t readBuffer);
-static void DCTII(float32_t *in, float32_t *out);
-static void deltas(float32_t **buffers);
-static float32_t neuralNetwork(float32_t *bufferMFCC);
-
-arm_rfft_fast_instance_f32 realFFTinstance;
-
-float32_t NN_THRESHOLD = 0.5f; // default value
+void LoadNNModel(void);
+
+#define DEFAULT_NN_THRESHOLD 0.5f
+#define DEFAULT_NN_PRETHRESHOLD 0.25f
+#define DEFAULT_NN_FREQUENCY_GATE_THRESHOLD 1.0f // percentage, as the frequency trigger of the configuration
+#define NN_FREQUENCY_GATE_WINDOW_LENGTH 128
+#define NN_FREQUENCY_GATE_HANGOVER_FRAMES 8
+#define DEFAULT_NN_CLIP_PREROLL 1.0f // seconds
+#define DEFAULT_NN_CLIP_POSTROLL 2.0f // seconds
+#define NN_CLIP_MAXIMUM_PREROLL_SUPERBUFFERS (NUMBER_OF_SUPERBUFFERS / 2) // leaves half the ring for the write lag
+#define DEFAULT_NN_EVENT_GAP 0.25f // seconds
+#define DEFAULT_NN_EVENT_MINIMUM 0.0f // seconds
+float32_t NN_THRESHOLDS[NN_MAXIMUM_NUMBER_OF_CLASSES]; // per class, set by LoadNNConfig()
+float32_t NN_PRETHRESHOLD = DEFAULT_NN_PRETHRESHOLD; // gate threshold of the cascade
+uint32_t NN_ENERGY_GATE_MARGIN = 0; // margin of the energy gate over the noise floor (1/256 units), 0 if disabled
+uint32_t NN_FREQUENCY_GATE = 0; // centre frequency of the frequency gate in Hz, 0 if disabled
+float32_t NN_FREQUENCY_GATE_THRESHOLD = DEFAULT_NN_FREQUENCY_GATE_THRESHOLD; // threshold of the frequency gate
+bool NN_DETECTION_ONLY = false; // run the detector without writing a WAV file
+bool NN_CLIP_CAPTURE = false; // write only the audio around the detections
+float32_t NN_CLIP_PREROLL = DEFAULT_NN_CLIP_PREROLL; // audio kept before each detection
+float32_t NN_CLIP_POSTROLL = DEFAULT_NN_CLIP_POSTROLL; // audio kept after each detection
+bool NN_EVENTS = false; // log events instead of detected frames
+float32_t NN_EVENT_GAP = DEFAULT_NN_EVENT_GAP; // longest gap without detections inside an event
+float32_t NN_EVENT_MINIMUM = DEFAULT_NN_EVENT_MINIMUM; // shortest event logged
+bool NN_BINARY_LOG = false; // append the detections to calls.bin instead of calls.txt
 // <---
 
 /* USB configuration data structure */
@@ -948,8 +987,12 @@ static bool writeConfigurationToFile(configSettings_t *configSettings, uint32_t
 
     // ---> Introduced
     LoadNNConfig(); 
-    int thScaled = (int)(NN_THRESHOLD * 100 + 0.5f); // change range, e.g. 0.75 -> 75
-    length = sprintf(configBuffer, "\r\n\r\nNN threshold                    : 0.%02d", thScaled); 
+    length = 0;
+    for (uint32_t i = 0; i < NN_MAXIMUM_NUMBER_OF_CLASSES; i += 1) {
+        if (isfinite(NN_THRESHOLDS[i]) == false) continue; // class not detected
+        int thScaled = (int)(NN_THRESHOLDS[i] * 100 + 0.5f); // change range, e.g. 0.75 -> 75
+        length += sprintf(configBuffer + length, "%sNN threshold, class %-12lu: %d.%02d", length == 0 ? "\r\n\r\n" : "\r\n", i, thScaled / 100, thScaled % 100); 
+    }
     // <---
     length += sprintf(configBuffer + length, "\r\n\r\nSample rate (Hz)                : %lu\r\n", configSettings->sampleRate / configSettings->sampleRateDivider); // modified +=, + length
     
@@ -2133,6 +2176,7 @@ int main(void) {
 
             if (fileSystemEnabled)  {
                 LoadNNConfig(); // Introduced
+                LoadNNModel(); // Introduced
                 recordingState = makeRecording(*timeOfNextRecording, *durationOfNextRecording, enableLED, extendedBatteryState, temperature, &fileOpenTime, &fileOpenMilliseconds);
 
             } else {
@@ -2921,6 +2965,58 @@ static void generateFolderAndFilename(char *foldername, char *filename, uint32_t
 
 }
 
+/* Introduced: write a superbuffer of a detection clip, or add it to the compressed silence between the clips */
+
+static AM_recordingState_t writeClipSuperbuffer(uint32_t superbuffer, uint32_t numberOfSamplesToWrite, bool writeAudio, bool enableLED, uint32_t *numberOfCompressedBuffers, uint32_t *totalNumberOfCompressedSamples) {
+
+    /* Superbuffers start at the beginning of the ring, so each has a fixed place in it */
+
+    int16_t *source = buffers[(superbuffer & (NUMBER_OF_SUPERBUFFERS - 1)) * NUMBER_OF_BUFFERS_IN_SUPERBUFFER];
+
+    /* The first superbuffer holds the header and the last may be partial, so only the others are compressed */
+
+    if (writeAudio == false && superbuffer > 0 && numberOfSamplesToWrite == NUMBER_OF_SAMPLES_IN_SUPERBUFFER) {
+
+        *numberOfCompressedBuffers += NUMBER_OF_BYTES_IN_SAMPLE * NUMBER_OF_SAMPLES_IN_SUPERBUFFER / COMPRESSION_BUFFER_SIZE_IN_BYTES;
+
+        return RECORDING_OKAY;
+
+    }
+
+    /* Light LED during SD card write if appropriate */
+
+    if (enableLED) AudioMoth_setRedLED(true);
+
+    /* Encode and write compression buffer */
+
+    if (*numberOfCompressedBuffers > 0) {
+
+        encodeCompressionBuffer(*numberOfCompressedBuffers);
+
+        *totalNumberOfCompressedSamples += (*numberOfCompressedBuffers - 1) * COMPRESSION_BUFFER_SIZE_IN_BYTES / NUMBER_OF_BYTES_IN_SAMPLE;
+
+        FLASH_LED_AND_RETURN_ON_ERROR(AudioMoth_writeToFile(compressionBuffer, COMPRESSION_BUFFER_SIZE_IN_BYTES));
+
+        *numberOfCompressedBuffers = 0;
+
+    }
+
+    /* Write the superbuffer */
+
+    PROFILE_START(PROFILE_WRITE);
+
+    FLASH_LED_AND_RETURN_ON_ERROR(AudioMoth_writeToFile(source, NUMBER_OF_BYTES_IN_SAMPLE * numberOfSamplesToWrite));
+
+    PROFILE_STOP(PROFILE_WRITE);
+
+    /* Clear LED */
+
+    AudioMoth_setRedLED(false);
+
+    return RECORDING_OKAY;
+
+}
+
 /* Save recording to SD card */
 
 static AM_recordingState_t makeRecording(uint32_t timeOfNextRecording, uint32_t recordDuration, bool enableLED, AM_extendedBatteryState_t extendedBatteryState, int32_t temperature, uint32_t *fileOpenTime, uint32_t *fileOpenMilliseconds) {
@@ -2938,21 +3034,35 @@ static AM_recordingState_t makeRecording(uint32_t timeOfNextRecording, uint32_t
     }
     
     // ---> Introduced: 
-    buffersMFCC[0] = (float32_t*)malloc(sizeof(float32_t) * NUMBER_OF_SAMPLES_IN_BUFFERS_MFCC);
-    for (int i = 1; i < NUMBER_OF_BUFFERS_MFCC; i += 1) {
-		if (i==3){
-			buffersMFCC[i] = buffersMFCC[i - 1] + 2*NUMBER_OF_SAMPLES_IN_BUFFERS_MFCC;
-		}
-		else {
-			buffersMFCC[i] = buffersMFCC[i - 1] + NUMBER_OF_SAMPLES_IN_BUFFERS_MFCC;
-		}
-	}
+    PROFILE_RESET();
+
+    Detector_resetArena(&detectorArena);
+
+    DetectionLog_reset(&detectionLog, timeOfNextRecording, configSettings->timezoneHours * MINUTES_IN_HOUR + configSettings->timezoneMinutes);
+
+    DetectionLog_setEvents(&detectionLog, NN_EVENTS, (uint32_t)(MILLISECONDS_IN_SECOND * MAX(0.0f, NN_EVENT_GAP)), (uint32_t)(MILLISECONDS_IN_SECOND * MAX(0.0f, NN_EVENT_MINIMUM)));
     // <---
 
     /* Calculate effective sample rate */
 
     uint32_t effectiveSampleRate = configSettings->sampleRate / configSettings->sampleRateDivider;
 
+    /* Introduced: header of the detections of this recording in calls.bin */
+
+    DetectionLog_initialiseHeader(&detectionLog, &detectionLogHeader, (uint8_t*)AM_UNIQUE_ID_START_ADDRESS, effectiveSampleRate);
+
+    detectionLogHeader.flags |= cascadeEnabled ? DETECTION_LOG_FLAG_CASCADE : 0;
+
+    detectionLogHeader.modelCRC = neuralNetworkModel.crc;
+
+    detectionLogHeader.confirmerCRC = cascadeEnabled ? confirmerModel.crc : 0;
+
+    detectionLogHeader.numberOfClasses = neuralNetworkModel.numberOfClasses;
+
+    memcpy(detectionLogHeader.thresholds, NN_THRESHOLDS, sizeof(detectionLogHeader.thresholds));
+
+    detectionLogHeaderPending = NN_BINARY_LOG;
+
     /* Set up the digital filter */
 
     uint32_t blockingFilterFrequency = configSettings->disable48HzDCBlockingFilter ? LOW_DC_BLOCKING_FREQ : DEFAULT_DC_BLOCKING_FREQ;
@@ -3051,6 +3161,16 @@ static AM_recordingState_t makeRecording(uint32_t timeOfNextRecording, uint32_t
 
     }
 
+    /* Introduced: point the frequency trigger at the call band to gate the detector. Every sector is written in this build, so the trigger of the configuration, if any, is used as it is, and otherwise the trigger replaces the amplitude threshold */
+
+    bool frequencyGateEnabled = NN_FREQUENCY_GATE > 0;
+
+    if (frequencyGateEnabled && frequencyTriggerEnabled == false) {
+
+        DigitalFilter_setFrequencyTrigger(NN_FREQUENCY_GATE_WINDOW_LENGTH, effectiveSampleRate, MIN(effectiveSampleRate / 2, NN_FREQUENCY_GATE), NN_FREQUENCY_GATE_THRESHOLD);
+
+    }
+
     /* Set the initial header comment details */
 
     AM_recordingState_t recordingState = SDCARD_WRITE_ERROR;
@@ -3059,9 +3179,25 @@ static AM_recordingState_t makeRecording(uint32_t timeOfNextRecording, uint32_t
 
     setHeaderComment(&wavHeader, configSettings, timeOfNextRecording, (uint8_t*)AM_UNIQUE_ID_START_ADDRESS, deploymentID, defaultDeploymentID, extendedBatteryState, temperature, externalMicrophone, recordingState, requestedFilterType);
 
+    /* Introduced: in detection-only mode no WAV file is opened or written, but the recording keeps its timing and the detections are logged */
+
+    bool writeWavFile = NN_DETECTION_ONLY == false;
+
+    /* Introduced: in clip capture mode only the superbuffers around the detections are written and the others are compressed as silence, so each superbuffer is decided once the pre-roll after it has been classified */
+
+    bool clipCaptureEnabled = NN_CLIP_CAPTURE && writeWavFile;
+
+    uint32_t clipPreRollSuperbuffers = MIN(NN_CLIP_MAXIMUM_PREROLL_SUPERBUFFERS, (uint32_t)ceilf(MAX(0.0f, NN_CLIP_PREROLL) * effectiveSampleRate / NUMBER_OF_SAMPLES_IN_SUPERBUFFER));
+
+    uint32_t clipPostRollSuperbuffers = (uint32_t)ceilf(MAX(0.0f, NN_CLIP_POSTROLL) * effectiveSampleRate / NUMBER_OF_SAMPLES_IN_SUPERBUFFER);
+
+    uint32_t clipEndSuperbuffer = 0;
+
+    uint32_t samplesCommitted = 0;
+
     /* Show LED for SD card activity */
 
-    if (enableLED) AudioMoth_setRedLED(true);
+    if (enableLED && writeWavFile) AudioMoth_setRedLED(true);
 
     /* Open a file with the current local time as the name */
 
@@ -3069,27 +3205,31 @@ static AM_recordingState_t makeRecording(uint32_t timeOfNextRecording, uint32_t
 
     static char foldername[MAXIMUM_FILE_NAME_LENGTH];
 
-    generateFolderAndFilename(foldername, filename, timeOfNextRecording, frequencyTriggerEnabled || amplitudeThresholdEnabled);
+    generateFolderAndFilename(foldername, filename, timeOfNextRecording, frequencyTriggerEnabled || amplitudeThresholdEnabled || clipCaptureEnabled);
 
-    if (configSettings->enableDailyFolders) {
+    if (writeWavFile) {
 
-        bool directoryExists = AudioMoth_doesDirectoryExist(foldername);
+        if (configSettings->enableDailyFolders) {
 
-        if (directoryExists == false) FLASH_LED_AND_RETURN_ON_ERROR(AudioMoth_makeDirectory(foldername));
+            bool directoryExists = AudioMoth_doesDirectoryExist(foldername);
 
-    }
+            if (directoryExists == false) FLASH_LED_AND_RETURN_ON_ERROR(AudioMoth_makeDirectory(foldername));
 
-    FLASH_LED_AND_RETURN_ON_ERROR(AudioMoth_openFile(filename));
+        }
 
-    /* Write the header */
+        FLASH_LED_AND_RETURN_ON_ERROR(AudioMoth_openFile(filename));
 
-    FLASH_LED_AND_RETURN_ON_ERROR(AudioMoth_writeToFile(&wavHeader, sizeof(wavHeader_t)));    
+        /* Write the header */
 
-    FLASH_LED_AND_RETURN_ON_ERROR(AudioMoth_syncFile());
+        FLASH_LED_AND_RETURN_ON_ERROR(AudioMoth_writeToFile(&wavHeader, sizeof(wavHeader_t)));    
 
-    FLASH_LED_AND_RETURN_ON_ERROR(AudioMoth_seekInFile(0));
+        FLASH_LED_AND_RETURN_ON_ERROR(AudioMoth_syncFile());
+
+        FLASH_LED_AND_RETURN_ON_ERROR(AudioMoth_seekInFile(0));
     
-    AudioMoth_setRedLED(false);
+        AudioMoth_setRedLED(false);
+
+    }
 
     /* Measure the time difference from the start time */
 
@@ -3149,6 +3289,30 @@ static AM_recordingState_t makeRecording(uint32_t timeOfNextRecording, uint32_t
 
     bool triggerHasOccurred = false;
 
+    /* Introduced: in cascade mode the per-frame model only has to pass its classes over the pre-threshold */
+
+    float32_t gateThresholds[NN_MAXIMUM_NUMBER_OF_CLASSES];
+
+    for (uint32_t i = 0; i < NN_MAXIMUM_NUMBER_OF_CLASSES; i += 1) {
+
+        gateThresholds[i] = cascadeEnabled && isfinite(NN_THRESHOLDS[i]) ? NN_PRETHRESHOLD : NN_THRESHOLDS[i];
+
+    }
+
+    /* Introduced: frames seen and skipped by the energy gate */
+
+    uint32_t numberOfFramesSeen = 0;
+
+    uint32_t numberOfFramesSkipped = 0;
+
+    uint32_t numberOfConsecutiveFramesSkipped = 0;
+
+    /* Introduced: frames skipped by the frequency gate */
+
+    uint32_t numberOfFramesSkippedByFrequencyGate = 0;
+
+    uint32_t frequencyGateHangover = 0;
+
     /* Start processing DMA transfers */
 
     numberOfDMATransfers = 0;
@@ -3165,22 +3329,63 @@ static AM_recordingState_t makeRecording(uint32_t timeOfNextRecording, uint32_t
         while (readBuffer != writeBuffer && samplesWritten < numberOfSamples + numberOfSamplesInHeader && !microphoneChanged && !switchPositionChanged && !magneticSwitch && !supplyVoltageLow) {
        
             /* --> Introduced code: MFCC and Neural Network */
-            // Shift buffers to the left 
-	    for (int j = 0; j <NUMBER_OF_SAMPLES_IN_BUFFERS_MFCC; j+= 1){
-				*(buffersMFCC[0]+j) = *(buffersMFCC[1]+j);
-				*(buffersMFCC[1]+j) = *(buffersMFCC[2]+j);
-				*(buffersMFCC[2]+j) = *(buffersMFCC[3]+j);
-				*(buffersMFCC[3]+j) = *(buffersMFCC[NUMBER_OF_BUFFERS_MFCC-1]+j);
+	    //Frequency gate: the Goertzel trigger of the digital filter on the call band, computed in the interrupt without sample rate division, held open for a few frames
+	    bool frequencyTriggered = false;
+	    if (frequencyGateEnabled) {
+	        frequencyTriggered = configSettings->sampleRateDivider > 1 ? DigitalFilter_applyFrequencyTrigger(buffers[readBuffer], NUMBER_OF_SAMPLES_IN_BUFFER) : writeIndicator[readBuffer];
+	        if (frequencyTriggered) frequencyGateHangover = NN_FREQUENCY_GATE_HANGOVER_FRAMES;
 	    }
-			
-	    //Calculate MFCCs corresponding buffer
-	    MFCC(buffers[readBuffer], buffersMFCC[NUMBER_OF_BUFFERS_MFCC-1], readBuffer);
-
-	    //Calculate deltas
-	    deltas(buffersMFCC);
+	    bool frequencyGateOpen = frequencyGateEnabled == false || frequencyGateHangover > 0;
+	    if (frequencyGateHangover > 0) frequencyGateHangover -= 1;
+	    numberOfFramesSkippedByFrequencyGate += frequencyGateOpen ? 0 : 1;
+
+	    //Energy gate: skip the MFCC and the neural network on buffers near the noise floor
+	    int32_t detectedClass = NN_NO_DETECTION;
+	    float32_t detectedScore = 0.0f;
+	    bool energyGateOpen = NN_ENERGY_GATE_MARGIN == 0 || Detector_applyEnergyGate(&detectorArena.energyGate, Detector_frameEnergy(buffers[readBuffer]), NN_ENERGY_GATE_MARGIN);
+	    numberOfFramesSkipped += energyGateOpen ? 0 : 1;
+
+	    if (frequencyGateOpen && energyGateOpen) {
+	        //Catch up the history with the skipped buffers still in the ring, so the deltas see consecutive frames.
+	        //The confirmer window needs a whole second of consecutive frames, so it starts again after a longer gap
+	        if (cascadeEnabled && numberOfConsecutiveFramesSkipped > NUMBER_OF_BUFFERS_MFCC - 1) Detector_resetWindow(&detectorArena.mfccWindow);
+	        for (uint32_t k = MIN(numberOfConsecutiveFramesSkipped, NUMBER_OF_BUFFERS_MFCC - 1); k > 0; k -= 1) {
+	            Detector_MFCC(&detectorArena.featureExtractor, buffers[(readBuffer - k) & (NUMBER_OF_BUFFERS - 1)], Detector_advanceHistory(&detectorArena.mfccHistory));
+	            if (cascadeEnabled) Detector_updateWindow(&detectorArena.mfccWindow, &detectorArena.mfccHistory);
+	        }
+	        numberOfConsecutiveFramesSkipped = 0;
+
+	        //Calculate MFCCs corresponding buffer into the newest slot of the history ring
+	        Detector_MFCC(&detectorArena.featureExtractor, buffers[readBuffer], Detector_advanceHistory(&detectorArena.mfccHistory));
+
+	        //Calculate deltas of the centre frame
+	        PROFILE_START(PROFILE_DELTAS);
+	        float32_t *features = Detector_deltas(&detectorArena.mfccHistory);
+	        PROFILE_STOP(PROFILE_DELTAS);
+
+	        //Apply neural network
+	        PROFILE_START(PROFILE_NEURAL_NETWORK);
+	        const float32_t *NNoutputs = Detector_neuralNetwork(&detectorArena.neuralNetwork, &neuralNetworkModel, features);
+	        detectedClass = Detector_classify(NNoutputs, gateThresholds, neuralNetworkModel.numberOfClasses);
+	        if (detectedClass != NN_NO_DETECTION) detectedScore = NNoutputs[detectedClass];
+	        PROFILE_STOP(PROFILE_NEURAL_NETWORK);
+
+	        //Cascade: confirm the candidate frames with the larger model over the last second of MFCCs
+	        if (cascadeEnabled) {
+	            Detector_updateWindow(&detectorArena.mfccWindow, &detectorArena.mfccHistory);
+	            if (detectedClass != NN_NO_DETECTION) {
+	                PROFILE_START(PROFILE_CONFIRMER);
+	                detectedClass = Detector_confirm(&detectorArena.neuralNetwork, &confirmerModel, &detectorArena.mfccWindow, NN_THRESHOLDS, &detectedScore);
+	                PROFILE_STOP(PROFILE_CONFIRMER);
+	            }
+	        }
+	    } else {
+	        numberOfConsecutiveFramesSkipped += 1;
+	    }
+	    numberOfFramesSeen += 1;
 
-	    //Apply neural network
-	    float32_t NNoutput = neuralNetwork(buffersMFCC[2]);
+	    //Clip capture: keep writing until the post-roll after this superbuffer
+	    if (detectedClass != NN_NO_DETECTION) clipEndSuperbuffer = buffersProcessed + clipPostRollSuperbuffers + 1;
 	    uint32_t BufferGreen = 0;
 	    // <---
 
@@ -3194,7 +3399,7 @@ static AM_recordingState_t makeRecording(uint32_t timeOfNextRecording, uint32_t
 
             bool writeIndicated = (amplitudeThresholdEnabled == false && frequencyTriggerEnabled == false) || writeIndicator[readBuffer];
 
-            if (frequencyTriggerEnabled && configSettings->sampleRateDivider > 1) writeIndicated = DigitalFilter_applyFrequencyTrigger(buffers[readBuffer], NUMBER_OF_SAMPLES_IN_BUFFER);
+            if (frequencyTriggerEnabled && configSettings->sampleRateDivider > 1) writeIndicated = frequencyGateEnabled ? frequencyTriggered : DigitalFilter_applyFrequencyTrigger(buffers[readBuffer], NUMBER_OF_SAMPLES_IN_BUFFER); // modified: computed once with the frequency gate
 
             /* Ensure the minimum number of buffers will be written */
 
@@ -3214,11 +3419,11 @@ static AM_recordingState_t makeRecording(uint32_t timeOfNextRecording, uint32_t
 
                 /* Light LED during SD card write if appropriate */
 
-                if (enableLED) AudioMoth_setRedLED(true); 
+                if (enableLED && writeWavFile && clipCaptureEnabled == false) AudioMoth_setRedLED(true); 
 
                 /* Encode and write compression buffer */
 
-                if (numberOfCompressedBuffers > 0) {
+                if (numberOfCompressedBuffers > 0 && writeWavFile) {
 
                     encodeCompressionBuffer(numberOfCompressedBuffers);
 
@@ -3236,17 +3441,31 @@ static AM_recordingState_t makeRecording(uint32_t timeOfNextRecording, uint32_t
 
                     // --> Introduced code:
                     if ((readBuffer+1) % NUMBER_OF_BUFFERS_IN_SUPERBUFFER == 0){ // for each superbuffer
-                      if (buffersProcessed == 0) memcpy(buffers[readBuffer], &wavHeader, sizeof(wavHeader_t));
+                      if (clipCaptureEnabled) { // Introduced: clip capture, decide on the superbuffer the pre-roll before this one
+                        if (buffersProcessed >= clipPreRollSuperbuffers) {
+                          uint32_t superbuffer = buffersProcessed - clipPreRollSuperbuffers;
+                          uint32_t numberOfClipSamples = MIN(numberOfSamples + numberOfSamplesInHeader - samplesCommitted, NUMBER_OF_SAMPLES_IN_SUPERBUFFER);
+                          AM_recordingState_t clipState = writeClipSuperbuffer(superbuffer, numberOfClipSamples, superbuffer < clipEndSuperbuffer, enableLED, &numberOfCompressedBuffers, &totalNumberOfCompressedSamples);
+                          if (clipState != RECORDING_OKAY) return clipState;
+                          samplesCommitted += numberOfClipSamples;
+                        }
+                      } else if (writeWavFile) { // Introduced: detection-only mode
+                        if (buffersProcessed == 0) memcpy(buffers[readBuffer], &wavHeader, sizeof(wavHeader_t));
                     
-                      //FLASH_LED_AND_RETURN_ON_ERROR(AudioMoth_writeToFile(buffers[readBuffer], NUMBER_OF_BYTES_IN_SAMPLE * numberOfSamplesToWrite));
-                      FLASH_LED_AND_RETURN_ON_ERROR(AudioMoth_writeToFile(buffers[readBuffer-NUMBER_OF_BUFFERS_IN_SUPERBUFFER+1], NUMBER_OF_BYTES_IN_SAMPLE * numberOfSamplesToWrite)); // modified. Write complete superbuffer
+                        //FLASH_LED_AND_RETURN_ON_ERROR(AudioMoth_writeToFile(buffers[readBuffer], NUMBER_OF_BYTES_IN_SAMPLE * numberOfSamplesToWrite));
+                        PROFILE_START(PROFILE_WRITE);
+                        FLASH_LED_AND_RETURN_ON_ERROR(AudioMoth_writeToFile(buffers[readBuffer-NUMBER_OF_BUFFERS_IN_SUPERBUFFER+1], NUMBER_OF_BYTES_IN_SAMPLE * numberOfSamplesToWrite)); // modified. Write complete superbuffer
+                        PROFILE_STOP(PROFILE_WRITE);
+                      }
                       
                       samplesWritten += numberOfSamplesToWrite;
 
 		      buffersProcessed += 1;
+
+		      writeDetections(DETECTION_LOG_SIZE); // Introduced: one append of calls.txt per superbuffer
                    }
                     
-                } else {
+                } else if (writeWavFile) {
 
                     clearCompressionBuffer();
 
@@ -3274,21 +3493,10 @@ static AM_recordingState_t makeRecording(uint32_t timeOfNextRecording, uint32_t
 
                 }
 
-                // --> Introduced code: Log detections if probability exceeds threshold
-		if (NNoutput > (float32_t)(NN_THRESHOLD)) {
-		    time_t rawtime = timeOfNextRecording + configSettings->timezoneHours * SECONDS_IN_HOUR + configSettings->timezoneMinutes * SECONDS_IN_MINUTE 
-		                      + (accumulatedMilliseconds / 1000);  // filename + accumulated milliseconds
-		    struct tm *time = gmtime(&rawtime);
-		    char str[24];
-		    sprintf(str, "%04d/%02d/%02d %02d:%02d:%02d.%02lu\n", 
-		                 1900 + time->tm_year, time->tm_mon + 1, time->tm_mday, time->tm_hour, time->tm_min, time->tm_sec, 
-		                 (accumulatedMilliseconds % 1000) / 10); //, readBuffer); // display only two decimal digits 
-        
-		    FIL callfile; //File to keep detections
-		    f_open(&callfile,"calls.txt", FA_OPEN_APPEND | FA_WRITE);
-		    f_puts(str,&callfile);
-		    f_close(&callfile);
-                    
+                // --> Introduced code: Log detections (with the class) if a class probability exceeds its threshold
+		// modified: every frame goes to the log, which merges the detections into events if enabled, and is appended to calls.txt once per superbuffer by writeDetections()
+		DetectionLog_addFrame(&detectionLog, accumulatedMilliseconds, detectedClass, detectedScore);
+		if (detectedClass != NN_NO_DETECTION) {
 		    AudioMoth_setGreenLED(true);
 		    BufferGreen = readBuffer;
 		} 
@@ -3331,9 +3539,35 @@ static AM_recordingState_t makeRecording(uint32_t timeOfNextRecording, uint32_t
 
     }
 
-    /* Write the compression buffer files at the end */
+    /* Introduced: append the remaining detections to calls.txt, with a single write if the recording was cut short by the supply voltage or the switch */
+
+    bool recordingInterrupted = microphoneChanged || switchPositionChanged || magneticSwitch || supplyVoltageLow;
+
+    DetectionLog_finish(&detectionLog);
+
+    writeDetections(recordingInterrupted ? 1 : DETECTION_LOG_SIZE);
+
+    /* Introduced: decide on the superbuffers of a clip still waiting for their pre-roll, which are still in the ring */
+
+    if (clipCaptureEnabled) {
 
-    if (samplesWritten < numberOfSamples + numberOfSamplesInHeader && numberOfCompressedBuffers > 0) {
+        for (uint32_t superbuffer = buffersProcessed > clipPreRollSuperbuffers ? buffersProcessed - clipPreRollSuperbuffers : 0; superbuffer < buffersProcessed; superbuffer += 1) {
+
+            uint32_t numberOfClipSamples = MIN(numberOfSamples + numberOfSamplesInHeader - samplesCommitted, NUMBER_OF_SAMPLES_IN_SUPERBUFFER);
+
+            AM_recordingState_t clipState = writeClipSuperbuffer(superbuffer, numberOfClipSamples, superbuffer < clipEndSuperbuffer, enableLED, &numberOfCompressedBuffers, &totalNumberOfCompressedSamples);
+
+            if (clipState != RECORDING_OKAY) return clipState;
+
+            samplesCommitted += numberOfClipSamples;
+
+        }
+
+    }
+
+    /* Write the compression buffer files at the end (modified: always after clips, to keep the timeline) */
+
+    if ((samplesWritten < numberOfSamples + numberOfSamplesInHeader || clipCaptureEnabled) && numberOfCompressedBuffers > 0 && writeWavFile) {
 
         /* Light LED during SD card write if appropriate */
 
@@ -3368,54 +3602,83 @@ static AM_recordingState_t makeRecording(uint32_t timeOfNextRecording, uint32_t
 
     if (timeOffset > 0) {
 
-        generateFolderAndFilename(foldername, newFilename, timeOfNextRecording + timeOffset, frequencyTriggerEnabled || amplitudeThresholdEnabled);
+        generateFolderAndFilename(foldername, newFilename, timeOfNextRecording + timeOffset, frequencyTriggerEnabled || amplitudeThresholdEnabled || clipCaptureEnabled);
 
     }
 
-    /* Write the GUANO data */
+    /* Finish the WAV file (Introduced: unless in detection-only mode) */
+
+    if (writeWavFile) {
 
-    bool gpsLocationReceived = getBackupFlag(BACKUP_GPS_LOCATION_RECEIVED);
+        /* Write the GUANO data */
 
-    bool acousticLocationReceived = getBackupFlag(BACKUP_ACOUSTIC_LOCATION_RECEIVED);
+        bool gpsLocationReceived = getBackupFlag(BACKUP_GPS_LOCATION_RECEIVED);
 
-    uint32_t guanoDataSize = writeGuanoData((char*)compressionBuffer, configSettings, timeOfNextRecording + timeOffset, gpsLocationReceived, gpsLastFixLatitude, gpsLastFixLongitude, acousticLocationReceived, acousticLatitude, acousticLongitude, firmwareDescription, firmwareVersion, (uint8_t*)AM_UNIQUE_ID_START_ADDRESS, deploymentID, defaultDeploymentID, timeOffset > 0 ? newFilename : filename, extendedBatteryState, temperature, requestedFilterType);
+        bool acousticLocationReceived = getBackupFlag(BACKUP_ACOUSTIC_LOCATION_RECEIVED);
 
-    FLASH_LED_AND_RETURN_ON_ERROR(AudioMoth_writeToFile(compressionBuffer, guanoDataSize));
+        uint32_t guanoDataSize = writeGuanoData((char*)compressionBuffer, configSettings, timeOfNextRecording + timeOffset, gpsLocationReceived, gpsLastFixLatitude, gpsLastFixLongitude, acousticLocationReceived, acousticLatitude, acousticLongitude, firmwareDescription, firmwareVersion, (uint8_t*)AM_UNIQUE_ID_START_ADDRESS, deploymentID, defaultDeploymentID, timeOffset > 0 ? newFilename : filename, extendedBatteryState, temperature, requestedFilterType);
+
+        FLASH_LED_AND_RETURN_ON_ERROR(AudioMoth_writeToFile(compressionBuffer, guanoDataSize));
     
-    /* Initialise the WAV header */
+        /* Initialise the WAV header */
 
-    samplesWritten = MAX(numberOfSamplesInHeader, samplesWritten);
+        samplesWritten = MAX(numberOfSamplesInHeader, samplesWritten);
 
-    setHeaderDetails(&wavHeader, effectiveSampleRate, samplesWritten - numberOfSamplesInHeader - totalNumberOfCompressedSamples, guanoDataSize);
+        setHeaderDetails(&wavHeader, effectiveSampleRate, samplesWritten - numberOfSamplesInHeader - totalNumberOfCompressedSamples, guanoDataSize);
 
-    setHeaderComment(&wavHeader, configSettings, timeOfNextRecording + timeOffset, (uint8_t*)AM_UNIQUE_ID_START_ADDRESS, deploymentID, defaultDeploymentID, extendedBatteryState, temperature, externalMicrophone, recordingState, requestedFilterType);
+        setHeaderComment(&wavHeader, configSettings, timeOfNextRecording + timeOffset, (uint8_t*)AM_UNIQUE_ID_START_ADDRESS, deploymentID, defaultDeploymentID, extendedBatteryState, temperature, externalMicrophone, recordingState, requestedFilterType);
 
-    /* Write the header */
+        /* Write the header */
 
-    if (enableLED) AudioMoth_setRedLED(true);
+        if (enableLED) AudioMoth_setRedLED(true);
 
-    FLASH_LED_AND_RETURN_ON_ERROR(AudioMoth_seekInFile(0));
+        FLASH_LED_AND_RETURN_ON_ERROR(AudioMoth_seekInFile(0));
 
-    FLASH_LED_AND_RETURN_ON_ERROR(AudioMoth_writeToFile(&wavHeader, sizeof(wavHeader_t)));
+        FLASH_LED_AND_RETURN_ON_ERROR(AudioMoth_writeToFile(&wavHeader, sizeof(wavHeader_t)));
 
-    /* Close the file */
+        /* Close the file */
 
-    FLASH_LED_AND_RETURN_ON_ERROR(AudioMoth_closeFile());
+        FLASH_LED_AND_RETURN_ON_ERROR(AudioMoth_closeFile());
 
-    AudioMoth_setRedLED(false);
+        AudioMoth_setRedLED(false);
 
-    /* Rename the file if necessary */
+        /* Rename the file if necessary */
 
-    if (timeOffset > 0) {
+        if (timeOffset > 0) {
 
-        if (enableLED) AudioMoth_setRedLED(true);
+            if (enableLED) AudioMoth_setRedLED(true);
 
-        FLASH_LED_AND_RETURN_ON_ERROR(AudioMoth_renameFile(filename, newFilename));
+            FLASH_LED_AND_RETURN_ON_ERROR(AudioMoth_renameFile(filename, newFilename));
 
-        AudioMoth_setRedLED(false);
+            AudioMoth_setRedLED(false);
+
+        }
 
     }
 
+#ifdef ENABLE_PROFILING
+    writeProfile(timeOffset > 0 ? newFilename : filename); // Introduced
+#endif
+
+    // Introduced: log how much of the recording the gates skipped
+    static char gateMessage[96];
+    if (frequencyGateEnabled) {
+        sprintf(gateMessage, "%s: frequency gate skipped %lu of %lu frames\n", timeOffset > 0 ? newFilename : filename, numberOfFramesSkippedByFrequencyGate, numberOfFramesSeen);
+        writeLog(gateMessage);
+    }
+    if (NN_ENERGY_GATE_MARGIN > 0) {
+        sprintf(gateMessage, "%s: energy gate skipped %lu of %lu frames\n", timeOffset > 0 ? newFilename : filename, numberOfFramesSkipped, numberOfFramesSeen);
+        writeLog(gateMessage);
+    }
+    if (detectionLog.numberOfDropped > 0 || detectionLog.numberOfEntries > 0) {
+        sprintf(gateMessage, "%s: %lu detections not written to %s\n", timeOffset > 0 ? newFilename : filename, detectionLog.numberOfDropped + detectionLog.numberOfEntries, NN_BINARY_LOG ? "calls.bin" : "calls.txt");
+        writeLog(gateMessage);
+    }
+    if (detectionLog.numberOfDiscardedEvents > 0) {
+        sprintf(gateMessage, "%s: %lu events shorter than the minimum duration\n", timeOffset > 0 ? newFilename : filename, detectionLog.numberOfDiscardedEvents);
+        writeLog(gateMessage);
+    }
+
     /* Return recording state */
 
     return recordingState;
@@ -4119,6 +4382,68 @@ void writeLog(char *str)
     // If opening fails, toggle an LED? 
 }
 
+/* Function: writeDetections
+ * Purpose: append the detections kept in RAM to "calls.txt" on the SD card,
+ *          opening the file once for all of them. The lines are formatted
+ *          in the compression buffer, which is free between SD card writes.
+ *          At most maximumNumberOfWrites buffers are written, so that an
+ *          interrupted recording spends a bounded time here. With
+ *          NN_BINARY_LOG the records are appended to "calls.bin" unformatted,
+ *          after the header of the recording if it is still pending.
+ * -------------------------------------------------------------------------*/
+bool writeDetections(uint32_t maximumNumberOfWrites)
+{
+    FIL callfile; //File to keep detections
+    UINT bytesWritten;
+    char *buffer = (char*)compressionBuffer;
+
+    if (detectionLog.numberOfEntries == 0) return true;
+
+    FRESULT res = f_open(&callfile, NN_BINARY_LOG ? "calls.bin" : "calls.txt", FA_OPEN_APPEND | FA_WRITE);
+
+    if (res != FR_OK) return false;
+
+    if (detectionLogHeaderPending) {
+        res = f_write(&callfile, &detectionLogHeader, sizeof(detectionLogHeader_t), &bytesWritten);
+        detectionLogHeaderPending = res != FR_OK;
+    }
+
+    for (uint32_t i = 0; i < maximumNumberOfWrites && res == FR_OK; i += 1) {
+        uint32_t length = NN_BINARY_LOG ? DetectionLog_encode(&detectionLog, (uint8_t*)buffer, COMPRESSION_BUFFER_SIZE_IN_BYTES) : DetectionLog_format(&detectionLog, buffer, COMPRESSION_BUFFER_SIZE_IN_BYTES);
+        if (length == 0) break;
+        res = f_write(&callfile, buffer, length, &bytesWritten);
+    }
+
+    f_close(&callfile);
+
+    return res == FR_OK;
+}
+
+#ifdef ENABLE_PROFILING
+
+/* Function: writeProfile
+ * Purpose: append the per-stage timing statistics of the last recording to
+ *          "profile.txt" on the SD card (ENABLE_PROFILING builds only).
+ * -------------------------------------------------------------------------*/
+void writeProfile(char *filename)
+{
+    static char profileBuffer[1024];
+    FIL outfile;
+
+    FRESULT res = f_open(&outfile, "profile.txt",
+                         FA_OPEN_APPEND | FA_OPEN_ALWAYS | FA_WRITE);
+
+    if (res == FR_OK) {
+        uint32_t length = sprintf(profileBuffer, "%s\r\n", filename);
+        Profiler_formatReport(profileBuffer + length, sizeof(profileBuffer) - length);
+        f_puts(profileBuffer, &outfile);
+        f_puts("\r\n", &outfile);
+        f_close(&outfile);
+    }
+}
+
+#endif
+
 /* 
  * Function:  parseFloat
  * Purpose:   Convert a decimal string (e.g. "3.1415") into a float WITHOUT
@@ -4174,25 +4499,60 @@ float parseFloat(const char *str)
 
 /* 
  * Function:  LoadNNConfig
- * Purpose:   Read NN_THRESHOLD from "NN_CONFIG.txt" on the SD card.
- *            If the file is missing or the value is invalid, fallback
- *            to a default value already stored in the global variable.
+ * Purpose:   Read the per-class thresholds from "NN_CONFIG.txt" on the
+ *            SD card: "NN_THRESHOLD=0.75" sets class 0 and
+ *            "NN_THRESHOLD_2=0.6" sets class 2. Class 0 defaults to 0.5
+ *            and the other classes (e.g. the background class of a 2-way
+ *            model) are not detected unless they are given a threshold.
+ *            "NN_PRETHRESHOLD=0.25" sets the gate threshold of the cascade,
+ *            "NN_ENERGY_GATE=6" skips the buffers less than 6 dB over
+ *            the noise floor and "NN_FREQUENCY_GATE=4400" skips the
+ *            buffers without energy in the band at 4.4 kHz, over
+ *            "NN_FREQUENCY_GATE_THRESHOLD=1.0" percent (both disabled by
+ *            default). "NN_DETECTION_ONLY=1" runs the detector without
+ *            writing the WAV files, and "NN_CLIP_CAPTURE=1" writes only
+ *            "NN_CLIP_PREROLL=1.0" seconds before and "NN_CLIP_POSTROLL=2.0"
+ *            seconds after each detection. "NN_EVENTS=1" logs events
+ *            merged over gaps of up to "NN_EVENT_GAP=0.25" seconds and
+ *            at least "NN_EVENT_MINIMUM=0.0" seconds long, and
+ *            "NN_BINARY_LOG=1" appends them to "calls.bin" as binary records.
  *
  * Steps:
- *   1. Open "NN_CONFIG.txt"; log error if the file cannot be opened.
- *   2. Read the file line by line, looking for "NN_THRESHOLD".
- *   3. If found, skip to the value and convert it using parseFloat().
- *   4. Log the value used (parsed or default) to "used_th.txt".
+ *   1. Reset the thresholds to their defaults.
+ *   2. Open "NN_CONFIG.txt"; log error if the file cannot be opened.
+ *   3. Read the file line by line, looking for "NN_THRESHOLD",
+ *      "NN_PRETHRESHOLD", "NN_ENERGY_GATE", "NN_FREQUENCY_GATE",
+ *      "NN_DETECTION_ONLY", "NN_CLIP_*", "NN_EVENT*" and "NN_BINARY_LOG"
+ *      lines.
+ *   4. For each, read the optional class number, skip to the value and
+ *      convert it using parseFloat().
  *
- * Parameters: None (uses global NN_THRESHOLD).
+ * Parameters: None (uses global NN_THRESHOLDS).
  */
 void LoadNNConfig(void)
 {
     FRESULT result;
     FIL file;
-    char line[24];
+    char line[40];
     bool valueFound = false;
 
+    // Defaults: class 0 only
+    for (uint32_t i = 0; i < NN_MAXIMUM_NUMBER_OF_CLASSES; i += 1) {
+        NN_THRESHOLDS[i] = i == 0 ? DEFAULT_NN_THRESHOLD : INFINITY;
+    }
+    NN_PRETHRESHOLD = DEFAULT_NN_PRETHRESHOLD;
+    NN_ENERGY_GATE_MARGIN = 0;
+    NN_FREQUENCY_GATE = 0;
+    NN_FREQUENCY_GATE_THRESHOLD = DEFAULT_NN_FREQUENCY_GATE_THRESHOLD;
+    NN_DETECTION_ONLY = false;
+    NN_CLIP_CAPTURE = false;
+    NN_CLIP_PREROLL = DEFAULT_NN_CLIP_PREROLL;
+    NN_CLIP_POSTROLL = DEFAULT_NN_CLIP_POSTROLL;
+    NN_EVENTS = false;
+    NN_BINARY_LOG = false;
+    NN_EVENT_GAP = DEFAULT_NN_EVENT_GAP;
+    NN_EVENT_MINIMUM = DEFAULT_NN_EVENT_MINIMUM;
+
     // Open configuration file 
     result = f_open(&file, "NN_CONFIG.txt", FA_READ);
     if (result != FR_OK) {
@@ -4200,7 +4560,7 @@ void LoadNNConfig(void)
         return;                             // default value 
     }
 
-    // Scan lines until NN_THRESHOLD is found 
+    // Scan all lines for NN_THRESHOLD and NN_THRESHOLD_<class>
     while (f_gets(line, sizeof(line), &file))
     {
         char *p = line;
@@ -4209,250 +4569,174 @@ void LoadNNConfig(void)
         if (strncmp(p, "NN_THRESHOLD", 12) == 0) // Check if line starts with "NN_THRESHOLD"
         {
             p += 12;                       // Move past "NN_THRESHOLD"
+
+            uint32_t thresholdClass = 0;
+            if (*p == '_') {               // Class number
+                p++;
+                while (*p >= '0' && *p <= '9') thresholdClass = 10 * thresholdClass + (*p++ - '0');
+            }
             while (isspace(*p) || *p == '=') p++; // Skip '=' and spaces
 
             // Parse and store value 
-            NN_THRESHOLD = parseFloat(p);
-            valueFound   = true;
-            break;
+            if (thresholdClass < NN_MAXIMUM_NUMBER_OF_CLASSES) {
+                NN_THRESHOLDS[thresholdClass] = parseFloat(p);
+                valueFound = true;
+            }
+        }
+        else if (strncmp(p, "NN_PRETHRESHOLD", 15) == 0) // Gate threshold of the cascade
+        {
+            p += 15;
+            while (isspace(*p) || *p == '=') p++; // Skip '=' and spaces
+            NN_PRETHRESHOLD = parseFloat(p);
+        }
+        else if (strncmp(p, "NN_ENERGY_GATE", 14) == 0) // Energy gate margin in dB over the noise floor
+        {
+            p += 14;
+            while (isspace(*p) || *p == '=') p++; // Skip '=' and spaces
+            float margin = parseFloat(p);
+            if (margin > ENERGY_GATE_MAXIMUM_MARGIN_DB) margin = ENERGY_GATE_MAXIMUM_MARGIN_DB; // Keep the margin within 32 bits
+            NN_ENERGY_GATE_MARGIN = margin > 0 ? (uint32_t)(ENERGY_GATE_MARGIN_ONE * powf(10.0f, margin / 10.0f) + 0.5f) : 0;
+        }
+        else if (strncmp(p, "NN_FREQUENCY_GATE_THRESHOLD", 27) == 0) // Frequency gate threshold (percentage)
+        {
+            p += 27;
+            while (isspace(*p) || *p == '=') p++; // Skip '=' and spaces
+            NN_FREQUENCY_GATE_THRESHOLD = parseFloat(p);
+        }
+        else if (strncmp(p, "NN_FREQUENCY_GATE", 17) == 0) // Frequency gate centre frequency (Hz)
+        {
+            p += 17;
+            while (isspace(*p) || *p == '=') p++; // Skip '=' and spaces
+            NN_FREQUENCY_GATE = (uint32_t)parseFloat(p);
+        }
+        else if (strncmp(p, "NN_DETECTION_ONLY", 17) == 0) // Detection-only mode (0 or 1)
+        {
+            p += 17;
+            while (isspace(*p) || *p == '=') p++; // Skip '=' and spaces
+            NN_DETECTION_ONLY = parseFloat(p) > 0;
+        }
+        else if (strncmp(p, "NN_CLIP_CAPTURE", 15) == 0) // Clip capture mode (0 or 1)
+        {
+            p += 15;
+            while (isspace(*p) || *p == '=') p++; // Skip '=' and spaces
+            NN_CLIP_CAPTURE = parseFloat(p) > 0;
+        }
+        else if (strncmp(p, "NN_CLIP_PREROLL", 15) == 0) // Clip pre-roll in seconds
+        {
+            p += 15;
+            while (isspace(*p) || *p == '=') p++; // Skip '=' and spaces
+            NN_CLIP_PREROLL = parseFloat(p);
+        }
+        else if (strncmp(p, "NN_CLIP_POSTROLL", 16) == 0) // Clip post-roll in seconds
+        {
+            p += 16;
+            while (isspace(*p) || *p == '=') p++; // Skip '=' and spaces
+            NN_CLIP_POSTROLL = parseFloat(p);
+        }
+        else if (strncmp(p, "NN_EVENT_GAP", 12) == 0) // Gap tolerance of the events in seconds
+        {
+            p += 12;
+            while (isspace(*p) || *p == '=') p++; // Skip '=' and spaces
+            NN_EVENT_GAP = parseFloat(p);
+        }
+        else if (strncmp(p, "NN_EVENT_MINIMUM", 16) == 0) // Minimum duration of the events in seconds
+        {
+            p += 16;
+            while (isspace(*p) || *p == '=') p++; // Skip '=' and spaces
+            NN_EVENT_MINIMUM = parseFloat(p);
+        }
+        else if (strncmp(p, "NN_EVENTS", 9) == 0) // Event logging (0 or 1)
+        {
+            p += 9;
+            while (isspace(*p) || *p == '=') p++; // Skip '=' and spaces
+            NN_EVENTS = parseFloat(p) > 0;
+        }
+        else if (strncmp(p, "NN_BINARY_LOG", 13) == 0) // Binary detection log (0 or 1)
+        {
+            p += 13;
+            while (isspace(*p) || *p == '=') p++; // Skip '=' and spaces
+            NN_BINARY_LOG = parseFloat(p) > 0;
         }
     }
     f_close(&file);
 }
 
-
-
-/* FUNCTIONS NEEDED IN makeRecording THAT PERFORM MFCC EXTRACTION AND NEURAL NETWORK PROCESSING */
-
 /* 
- * Function: MFCC
- * Purpose: Compute Mel Frequency Cepstral Coefficients (MFCCs) from the input audio buffer.
- * 
- * Steps:
- * 1. Apply a Hamming window to the input audio samples.
- * 2. Perform an FFT to compute the frequency domain representation of the audio.
- * 3. Apply Mel filter banks to extract relevant frequency features.
- * 4. Log-transform the energy values of the filtered frequencies.
- * 5. Perform a Discrete Cosine Transform (DCT) to obtain MFCCs.
+ * Function:  readModelFile
+ * Purpose:   Read a model file from the SD card into its image in RAM and
+ *            validate it with NNModel_parse(), which only replaces the
+ *            model if the size, version, CRC and layer shapes are all
+ *            correct.
  *
  * Parameters:
- *  - bufferIN: Pointer to input audio samples.
- *  - bufferOUT: Pointer to store the calculated MFCCs.
- *  - readBuffer: Index of the buffer being processed.
+ *   filename       - Name of the model file.
+ *   image          - Word aligned image, NN_MODEL_MAXIMUM_SIZE bytes.
+ *   model          - Model to describe.
+ *   numberOfInputs - Inputs the model must take.
+ *
+ * Returns: NN_MODEL_OK, NN_MODEL_MISSING or the reason for the rejection.
  */
-static void MFCC(int16_t *bufferIN, float32_t *bufferOUT, uint32_t readBuffer){
-
-	// 1. Apply hamming window
-	static const float32_t hamming_window[NUMBER_OF_SAMPLES_IN_BUFFER] = {0.080000,0.080009,0.080035,0.080078,0.080139,0.080217,0.080312,0.080425,0.080555,0.080703,0.080867,0.081049,0.081249,0.081466,0.081700,0.081951,0.082219,0.082505,0.082808,0.083129,0.083466,0.083821,0.084193,0.084582,0.084989,0.085412,0.085853,0.086311,0.086785,0.087278,0.087787,0.088313,0.088856,0.089416,0.089993,0.090588,0.091199,0.091827,0.092472,0.093134,0.093812,0.094508,0.095220,0.095950,0.096695,0.097458,0.098237,0.099033,0.099846,0.100675,0.101521,0.102383,0.103262,0.104157,0.105069,0.105997,0.106942,0.107903,0.108880,0.109873,0.110883,0.111909,0.112951,0.114009,0.115083,0.116173,0.117279,0.118402,0.119540,0.120693,0.121863,0.123049,0.124250,0.125467,0.126699,0.127947,0.129211,0.130490,0.131785,0.133095,0.134420,0.135761,0.137117,0.138488,0.139874,0.141276,0.142692,0.144123,0.145570,0.147031,0.148507,0.149998,0.151503,0.153023,0.154558,0.156107,0.157671,0.159249,0.160842,0.162449,0.164070,0.165705,0.167355,0.169018,0.170696,0.172387,0.174092,0.175811,0.177544,0.179291,0.181051,0.182824,0.184611,0.186412,0.188226,0.190053,0.191893,0.193747,0.195613,0.197493,0.199385,0.201290,0.203208,0.205139,0.207082,0.209038,0.211007,0.212988,0.214981,0.216986,0.219004,0.221033,0.223075,0.225129,0.227195,0.229272,0.231361,0.233462,0.235574,0.237698,0.239833,0.241980,0.244137,0.246306,0.248486,0.250677,0.252879,0.255092,0.257315,0.259550,0.261794,0.264050,0.266315,0.268591,0.270877,0.273174,0.275480,0.277797,0.280123,0.282459,0.284805,0.287160,0.289525,0.291900,0.294283,0.296677,0.299079,0.301490,0.303910,0.306340,0.308778,0.311224,0.313680,0.316144,0.318616,0.321097,0.323586,0.326083,0.328588,0.331101,0.333623,0.336151,0.338688,0.341232,0.343784,0.346343,0.348909,0.351483,0.354063,0.356651,0.359246,0.361847,0.364455,0.367070,0.369691,0.372319,0.374953,0.377593,0.380240,0.382892,0.385550,0.388215,0.390884,0.393560,0.396241,0.398927,0.401619,0.404316,0.407018,0.409725,0.412438,0.415154,0.417876,0.420602,0.423333,0.426068,0.428807,0.431551,0.434299,0.437050,0.439806,0.442565,0.445328,0.448095,0.450865,0.453638,0.456415,0.459195,0.461977,0.464763,0.467552,0.470343,0.473137,0.475934,0.478733,0.481534,0.484337,0.487143,0.489950,0.492760,0.495571,0.498384,0.501199,0.504014,0.506832,0.509650,0.512470,0.515291,0.518112,0.520935,0.523758,0.526582,0.529406,0.532231,0.535056,0.537881,0.540706,0.543532,0.546357,0.549182,0.552006,0.554830,0.557654,0.560477,0.563299,0.566120,0.568940,0.571759,0.574577,0.577394,0.580209,0.583023,0.585835,0.588645,0.591454,0.594260,0.597065,0.599867,0.602667,0.605465,0.608260,0.611053,0.613843,0.616630,0.619414,0.622196,0.624974,0.627749,0.630521,0.633289,0.636054,0.638815,0.641572,0.644326,0.647076,0.649821,0.652563,0.655300,0.658033,0.660762,0.663485,0.666205,0.668919,0.671629,0.674333,0.677033,0.679727,0.682416,0.685100,0.687779,0.690451,0.693118,0.695780,0.698435,0.701084,0.703728,0.706365,0.708996,0.711620,0.714238,0.716850,0.719455,0.722053,0.724644,0.727228,0.729805,0.732375,0.734938,0.737493,0.740041,0.742581,0.745114,0.747639,0.750156,0.752665,0.755167,0.757660,0.760145,0.762621,0.765089,0.767549,0.770000,0.772442,0.774876,0.777301,0.779717,0.782123,0.784521,0.786910,0.789289,0.791658,0.794019,0.796369,0.798710,0.801041,0.803363,0.805674,0.807976,0.810267,0.812548,0.814819,0.817079,0.819329,0.821569,0.823798,0.826016,0.828223,0.830420,0.832605,0.834780,0.836943,0.839095,0.841236,0.843365,0.845484,0.847590,0.849685,0.851768,0.853840,0.855899,0.857947,0.859983,0.862007,0.864018,0.866017,0.868004,0.869979,0.871941,0.873891,0.875828,0.877752,0.879664,0.881563,0.883449,0.885322,0.887182,0.889029,0.890862,0.892683,0.894490,0.896284,0.898064,0.899831,0.901584,0.903324,0.905050,0.906762,0.908461,0.910145,0.911815,0.913472,0.915114,0.916742,0.918356,0.919956,0.921542,0.923112,0.924669,0.926211,0.927739,0.929251,0.930750,0.932233,0.933702,0.935155,0.936594,0.938018,0.939427,0.940821,0.942199,0.943563,0.944911,0.946244,0.947562,0.948864,0.950151,0.951423,0.952679,0.953919,0.955144,0.956353,0.957546,0.958724,0.959885,0.961031,0.962162,0.963276,0.964374,0.965456,0.966522,0.967572,0.968606,0.969624,0.970625,0.971611,0.972580,0.973533,0.974469,0.975389,0.976292,0.977179,0.978050,0.978904,0.979742,0.980562,0.981367,0.982154,0.982925,0.983680,0.984417,0.985138,0.985842,0.986529,0.987199,0.987853,0.988489,0.989109,0.989712,0.990297,0.990866,0.991418,0.991952,0.992470,0.992971,0.993454,0.993920,0.994370,0.994802,0.995217,0.995615,0.995995,0.996359,0.996705,0.997034,0.997345,0.997640,0.997917,0.998177,0.998420,0.998645,0.998853,0.999044,0.999217,0.999373,0.999512,0.999633,0.999738,0.999824,0.999894,0.999946,0.999980,0.999998,0.999998,0.999980,0.999946,0.999894,0.999824,0.999738,0.999633,0.999512,0.999373,0.999217,0.999044,0.998853,0.998645,0.998420,0.998177,0.997917,0.997640,0.997345,0.997034,0.996705,0.996359,0.995995,0.995615,0.995217,0.994802,0.994370,0.993920,0.993454,0.992971,0.992470,0.991952,0.991418,0.990866,0.990297,0.989712,0.989109,0.988489,0.987853,0.987199,0.986529,0.985842,0.985138,0.984417,0.983680,0.982925,0.982154,0.981367,0.980562,0.979742,0.978904,0.978050,0.977179,0.976292,0.975389,0.974469,0.973533,0.972580,0.971611,0.970625,0.969624,0.968606,0.967572,0.966522,0.965456,0.964374,0.963276,0.962162,0.961031,0.959885,0.958724,0.957546,0.956353,0.955144,0.953919,0.952679,0.951423,0.950151,0.948864,0.947562,0.946244,0.944911,0.943563,0.942199,0.940821,0.939427,0.938018,0.936594,0.935155,0.933702,0.932233,0.930750,0.929251,0.927739,0.926211,0.924669,0.923112,0.921542,0.919956,0.918356,0.916742,0.915114,0.913472,0.911815,0.910145,0.908461,0.906762,0.905050,0.903324,0.901584,0.899831,0.898064,0.896284,0.894490,0.892683,0.890862,0.889029,0.887182,0.885322,0.883449,0.881563,0.879664,0.877752,0.875828,0.873891,0.871941,0.869979,0.868004,0.866017,0.864018,0.862007,0.859983,0.857947,0.855899,0.853840,0.851768,0.849685,0.847590,0.845484,0.843365,0.841236,0.839095,0.836943,0.834780,0.832605,0.830420,0.828223,0.826016,0.823798,0.821569,0.819329,0.817079,0.814819,0.812548,0.810267,0.807976,0.805674,0.803363,0.801041,0.798710,0.796369,0.794019,0.791658,0.789289,0.786910,0.784521,0.782123,0.779717,0.777301,0.774876,0.772442,0.770000,0.767549,0.765089,0.762621,0.760145,0.757660,0.755167,0.752665,0.750156,0.747639,0.745114,0.742581,0.740041,0.737493,0.734938,0.732375,0.729805,0.727228,0.724644,0.722053,0.719455,0.716850,0.714238,0.711620,0.708996,0.706365,0.703728,0.701084,0.698435,0.695780,0.693118,0.690451,0.687779,0.685100,0.682416,0.679727,0.677033,0.674333,0.671629,0.668919,0.666205,0.663485,0.660762,0.658033,0.655300,0.652563,0.649821,0.647076,0.644326,0.641572,0.638815,0.636054,0.633289,0.630521,0.627749,0.624974,0.622196,0.619414,0.616630,0.613843,0.611053,0.608260,0.605465,0.602667,0.599867,0.597065,0.594260,0.591454,0.588645,0.585835,0.583023,0.580209,0.577394,0.574577,0.571759,0.568940,0.566120,0.563299,0.560477,0.557654,0.554830,0.552006,0.549182,0.546357,0.543532,0.540706,0.537881,0.535056,0.532231,0.529406,0.526582,0.523758,0.520935,0.518112,0.515291,0.512470,0.509650,0.506832,0.504014,0.501199,0.498384,0.495571,0.492760,0.489950,0.487143,0.484337,0.481534,0.478733,0.475934,0.473137,0.470343,0.467552,0.464763,0.461977,0.459195,0.456415,0.453638,0.450865,0.448095,0.445328,0.442565,0.439806,0.437050,0.434299,0.431551,0.428807,0.426068,0.423333,0.420602,0.417876,0.415154,0.412438,0.409725,0.407018,0.404316,0.401619,0.398927,0.396241,0.393560,0.390884,0.388215,0.385550,0.382892,0.380240,0.377593,0.374953,0.372319,0.369691,0.367070,0.364455,0.361847,0.359246,0.356651,0.354063,0.351483,0.348909,0.346343,0.343784,0.341232,0.338688,0.336151,0.333623,0.331101,0.328588,0.326083,0.323586,0.321097,0.318616,0.316144,0.313680,0.311224,0.308778,0.306340,0.303910,0.301490,0.299079,0.296677,0.294283,0.291900,0.289525,0.287160,0.284805,0.282459,0.280123,0.277797,0.275480,0.273174,0.270877,0.268591,0.266315,0.264050,0.261794,0.259550,0.257315,0.255092,0.252879,0.250677,0.248486,0.246306,0.244137,0.241980,0.239833,0.237698,0.235574,0.233462,0.231361,0.229272,0.227195,0.225129,0.223075,0.221033,0.219004,0.216986,0.214981,0.212988,0.211007,0.209038,0.207082,0.205139,0.203208,0.201290,0.199385,0.197493,0.195613,0.193747,0.191893,0.190053,0.188226,0.186412,0.184611,0.182824,0.181051,0.179291,0.177544,0.175811,0.174092,0.172387,0.170696,0.169018,0.167355,0.165705,0.164070,0.162449,0.160842,0.159249,0.157671,0.156107,0.154558,0.153023,0.151503,0.149998,0.148507,0.147031,0.145570,0.144123,0.142692,0.141276,0.139874,0.138488,0.137117,0.135761,0.134420,0.133095,0.131785,0.130490,0.129211,0.127947,0.126699,0.125467,0.124250,0.123049,0.121863,0.120693,0.119540,0.118402,0.117279,0.116173,0.115083,0.114009,0.112951,0.111909,0.110883,0.109873,0.108880,0.107903,0.106942,0.105997,0.105069,0.104157,0.103262,0.102383,0.101521,0.100675,0.099846,0.099033,0.098237,0.097458,0.096695,0.095950,0.095220,0.094508,0.093812,0.093134,0.092472,0.091827,0.091199,0.090588,0.089993,0.089416,0.088856,0.088313,0.087787,0.087278,0.086785,0.086311,0.085853,0.085412,0.084989,0.084582,0.084193,0.083821,0.083466,0.083129,0.082808,0.082505,0.082219,0.081951,0.081700,0.081466,0.081249,0.081049,0.080867,0.080703,0.080555,0.080425,0.080312,0.080217,0.080139,0.080078,0.080035,0.080009,0.080000};
-
-
-	float32_t hamw[NUMBER_OF_SAMPLES_IN_BUFFER] = {0};
-	for (int i = 1; i < NUMBER_OF_SAMPLES_IN_BUFFER; i+= 1){
-		hamw[i] = hamming_window[i] * (((float32_t)*(bufferIN+i))/(float32_t)MAX_INT_VALUE);
-	}
-
-	// 2. Perform FFT
-	float32_t cplxFFT[NUMBER_OF_SAMPLES_IN_BUFFER];
-	float32_t postFFT[NUMBER_OF_SAMPLES_IN_BUFFER/2];
-    arm_rfft_fast_init_f32 (&realFFTinstance,NUMBER_OF_SAMPLES_IN_BUFFER);
-    arm_rfft_fast_f32(&realFFTinstance, hamw, cplxFFT,0);
-    arm_cmplx_mag_f32(cplxFFT, postFFT, NUMBER_OF_SAMPLES_IN_BUFFER/2); //The input array has a total of 2*numSamples values; the output array has a total of numSamples values
-
-
-    // 3: Apply Mel filter banks and log-transform
-	static const int16_t infoH[NBANKS][2] = {{11,4},{13,4},{16,4},{18,5},{21,5},{24,5},{27,6},{30,7},{34,7},{38,7},{42,8},{46,8},{51,9},{55,10},{61,10},{66,12},{72,13},{79,13},{86,14},{93,16},{101,17},{110,17},{119,19},{128,21},{139,22},{150,23},{162,25},{174,27},{188,29},{202,31},{218,33},{234,36},{252,38},{271,41},{291,44},{313,47},{336,50},{361,53},{387,58},{415,62},{446,65}};
-	static const float32_t hbank[925] = {0.006387500000000,0.012775000000000,0.008516666666667,0.004258333333333,0.004258333333333,0.008516666666667,0.012775000000000,0.006387500000000,0.006387500000000,0.012775000000000,0.008516666666667,0.004258333333333,0.003548611111111,0.007097222222222,0.010645833333333,0.007097222222222,0.003548611111111,0.003548611111111,0.007097222222222,0.010645833333333,0.007097222222222,0.003548611111111,0.003548611111111,0.007097222222222,0.010645833333333,0.007097222222222,0.003548611111111,0.003041666666667,0.006083333333333,0.009125000000000,0.006843750000000,0.004562500000000,0.002281250000000,0.001996093750000,0.003992187500000,0.005988281250000,0.007984375000000,0.005988281250000,0.003992187500000,0.001996093750000,0.001996093750000,0.003992187500000,0.005988281250000,0.007984375000000,0.005988281250000,0.003992187500000,0.001996093750000,0.001996093750000,0.003992187500000,0.005988281250000,0.007984375000000,0.005988281250000,0.003992187500000,0.001996093750000,0.001774305555556,0.003548611111111,0.005322916666667,0.007097222222222,0.005677777777778,0.004258333333333,0.002838888888889,0.001419444444444,0.001419444444444,0.002838888888889,0.004258333333333,0.005677777777778,0.007097222222222,0.005322916666667,0.003548611111111,0.001774305555556,0.001596875000000,0.003193750000000,0.004790625000000,0.006387500000000,0.005322916666667,0.004258333333333,0.003193750000000,0.002129166666667,0.001064583333333,0.000967803030303,0.001935606060606,0.002903409090909,0.003871212121212,0.004839015151515,0.005806818181818,0.004645454545455,0.003484090909091,0.002322727272727,0.001161363636364,0.001161363636364,0.002322727272727,0.003484090909091,0.004645454545455,0.005806818181818,0.004839015151515,0.003871212121212,0.002903409090909,0.001935606060606,0.000967803030303,0.000818910256410,0.001637820512821,0.002456730769231,0.003275641025641,0.004094551282051,0.004913461538462,0.004211538461538,0.003509615384615,0.002807692307692,0.002105769230769,0.001403846153846,0.000701923076923,0.000651785714286,0.001303571428571,0.001955357142857,0.002607142857143,0.003258928571429,0.003910714285714,0.004562500000000,0.003910714285714,0.003258928571429,0.002607142857143,0.001955357142857,0.001303571428571,0.000651785714286,0.000651785714286,0.001303571428571,0.001955357142857,0.002607142857143,0.003258928571429,0.003910714285714,0.004562500000000,0.003910714285714,0.003258928571429,0.002607142857143,0.001955357142857,0.001303571428571,0.000651785714286,0.000608333333333,0.001216666666667,0.001825000000000,0.002433333333333,0.003041666666667,0.003650000000000,0.004258333333333,0.003726041666667,0.003193750000000,0.002661458333333,0.002129166666667,0.001596875000000,0.001064583333333,0.000532291666667,0.000469669117647,0.000939338235294,0.001409007352941,0.001878676470588,0.002348345588235,0.002818014705882,0.003287683823529,0.003757352941176,0.003339869281046,0.002922385620915,0.002504901960784,0.002087418300654,0.001669934640523,0.001252450980392,0.000834967320261,0.000417483660131,0.000394290123457,0.000788580246914,0.001182870370370,0.001577160493827,0.001971450617284,0.002365740740741,0.002760030864198,0.003154320987654,0.003548611111111,0.003154320987654,0.002760030864198,0.002365740740741,0.001971450617284,0.001577160493827,0.001182870370370,0.000788580246914,0.000394290123457,0.000394290123457,0.000788580246914,0.001182870370370,0.001577160493827,0.001971450617284,0.002365740740741,0.002760030864198,0.003154320987654,0.003548611111111,0.003154320987654,0.002760030864198,0.002365740740741,0.001971450617284,0.001577160493827,0.001182870370370,0.000788580246914,0.000394290123457,0.000354861111111,0.000709722222222,0.001064583333333,0.001419444444444,0.001774305555556,0.002129166666667,0.002484027777778,0.002838888888889,0.003193750000000,0.002903409090909,0.002613068181818,0.002322727272727,0.002032386363636,0.001742045454545,0.001451704545455,0.001161363636364,0.000871022727273,0.000580681818182,0.000290340909091,0.000263946280992,0.000527892561983,0.000791838842975,0.001055785123967,0.001319731404959,0.001583677685950,0.001847623966942,0.002111570247934,0.002375516528926,0.002639462809917,0.002903409090909,0.002639462809917,0.002375516528926,0.002111570247934,0.001847623966942,0.001583677685950,0.001319731404959,0.001055785123967,0.000791838842975,0.000527892561983,0.000263946280992,0.000252470355731,0.000504940711462,0.000757411067194,0.001009881422925,0.001262351778656,0.001514822134387,0.001767292490119,0.002019762845850,0.002272233201581,0.002524703557312,0.002777173913043,0.002545742753623,0.002314311594203,0.002082880434783,0.001851449275362,0.001620018115942,0.001388586956522,0.001157155797101,0.000925724637681,0.000694293478261,0.000462862318841,0.000231431159420,0.000221788194444,0.000443576388889,0.000665364583333,0.000887152777778,0.001108940972222,0.001330729166667,0.001552517361111,0.001774305555556,0.001996093750000,0.002217881944444,0.002439670138889,0.002661458333333,0.002439670138889,0.002217881944444,0.001996093750000,0.001774305555556,0.001552517361111,0.001330729166667,0.001108940972222,0.000887152777778,0.000665364583333,0.000443576388889,0.000221788194444,0.000204727564103,0.000409455128205,0.000614182692308,0.000818910256410,0.001023637820513,0.001228365384615,0.001433092948718,0.001637820512821,0.001842548076923,0.002047275641026,0.002252003205128,0.002456730769231,0.002281250000000,0.002105769230769,0.001930288461538,0.001754807692308,0.001579326923077,0.001403846153846,0.001228365384615,0.001052884615385,0.000877403846154,0.000701923076923,0.000526442307692,0.000350961538462,0.000175480769231,0.000162946428571,0.000325892857143,0.000488839285714,0.000651785714286,0.000814732142857,0.000977678571429,0.001140625000000,0.001303571428571,0.001466517857143,0.001629464285714,0.001792410714286,0.001955357142857,0.002118303571429,0.002281250000000,0.002118303571429,0.001955357142857,0.001792410714286,0.001629464285714,0.001466517857143,0.001303571428571,0.001140625000000,0.000977678571429,0.000814732142857,0.000651785714286,0.000488839285714,0.000325892857143,0.000162946428571,0.000152083333333,0.000304166666667,0.000456250000000,0.000608333333333,0.000760416666667,0.000912500000000,0.001064583333333,0.001216666666667,0.001368750000000,0.001520833333333,0.001672916666667,0.001825000000000,0.001977083333333,0.002129166666667,0.001996093750000,0.001863020833333,0.001729947916667,0.001596875000000,0.001463802083333,0.001330729166667,0.001197656250000,0.001064583333333,0.000931510416667,0.000798437500000,0.000665364583333,0.000532291666667,0.000399218750000,0.000266145833333,0.000133072916667,0.000124755859375,0.000249511718750,0.000374267578125,0.000499023437500,0.000623779296875,0.000748535156250,0.000873291015625,0.000998046875000,0.001122802734375,0.001247558593750,0.001372314453125,0.001497070312500,0.001621826171875,0.001746582031250,0.001871337890625,0.001996093750000,0.001871337890625,0.001746582031250,0.001621826171875,0.001497070312500,0.001372314453125,0.001247558593750,0.001122802734375,0.000998046875000,0.000873291015625,0.000748535156250,0.000623779296875,0.000499023437500,0.000374267578125,0.000249511718750,0.000124755859375,0.000117417279412,0.000234834558824,0.000352251838235,0.000469669117647,0.000587086397059,0.000704503676471,0.000821920955882,0.000939338235294,0.001056755514706,0.001174172794118,0.001291590073529,0.001409007352941,0.001526424632353,0.001643841911765,0.001761259191176,0.001878676470588,0.001774305555556,0.001669934640523,0.001565563725490,0.001461192810458,0.001356821895425,0.001252450980392,0.001148080065359,0.001043709150327,0.000939338235294,0.000834967320261,0.000730596405229,0.000626225490196,0.000521854575163,0.000417483660131,0.000313112745098,0.000208741830065,0.000104370915033,0.000095908408408,0.000191816816817,0.000287725225225,0.000383633633634,0.000479542042042,0.000575450450450,0.000671358858859,0.000767267267267,0.000863175675676,0.000959084084084,0.001054992492492,0.001150900900901,0.001246809309309,0.001342717717718,0.001438626126126,0.001534534534535,0.001630442942943,0.001726351351351,0.001635490753912,0.001544630156472,0.001453769559033,0.001362908961593,0.001272048364154,0.001181187766714,0.001090327169275,0.000999466571835,0.000908605974395,0.000817745376956,0.000726884779516,0.000636024182077,0.000545163584637,0.000454302987198,0.000363442389758,0.000272581792319,0.000181721194879,0.000090860597440,0.000086201079622,0.000172402159244,0.000258603238866,0.000344804318489,0.000431005398111,0.000517206477733,0.000603407557355,0.000689608636977,0.000775809716599,0.000862010796221,0.000948211875843,0.001034412955466,0.001120614035088,0.001206815114710,0.001293016194332,0.001379217273954,0.001465418353576,0.001551619433198,0.001637820512821,0.001555929487179,0.001474038461538,0.001392147435897,0.001310256410256,0.001228365384615,0.001146474358974,0.001064583333333,0.000982692307692,0.000900801282051,0.000818910256410,0.000737019230769,0.000655128205128,0.000573237179487,0.000491346153846,0.000409455128205,0.000327564102564,0.000245673076923,0.000163782051282,0.000081891025641,0.000076041666667,0.000152083333333,0.000228125000000,0.000304166666667,0.000380208333333,0.000456250000000,0.000532291666667,0.000608333333333,0.000684375000000,0.000760416666667,0.000836458333333,0.000912500000000,0.000988541666667,0.001064583333333,0.001140625000000,0.001216666666667,0.001292708333333,0.001368750000000,0.001444791666667,0.001520833333333,0.001451704545455,0.001382575757576,0.001313446969697,0.001244318181818,0.001175189393939,0.001106060606061,0.001036931818182,0.000967803030303,0.000898674242424,0.000829545454545,0.000760416666667,0.000691287878788,0.000622159090909,0.000553030303030,0.000483901515152,0.000414772727273,0.000345643939394,0.000276515151515,0.000207386363636,0.000138257575758,0.000069128787879,0.000064520202020,0.000129040404040,0.000193560606061,0.000258080808081,0.000322601010101,0.000387121212121,0.000451641414141,0.000516161616162,0.000580681818182,0.000645202020202,0.000709722222222,0.000774242424242,0.000838762626263,0.000903282828283,0.000967803030303,0.001032323232323,0.001096843434343,0.001161363636364,0.001225883838384,0.001290404040404,0.001354924242424,0.001419444444444,0.001357729468599,0.001296014492754,0.001234299516908,0.001172584541063,0.001110869565217,0.001049154589372,0.000987439613527,0.000925724637681,0.000864009661836,0.000802294685990,0.000740579710145,0.000678864734300,0.000617149758454,0.000555434782609,0.000493719806763,0.000432004830918,0.000370289855072,0.000308574879227,0.000246859903382,0.000185144927536,0.000123429951691,0.000061714975845,0.000057857789855,0.000115715579710,0.000173573369565,0.000231431159420,0.000289288949275,0.000347146739130,0.000405004528986,0.000462862318841,0.000520720108696,0.000578577898551,0.000636435688406,0.000694293478261,0.000752151268116,0.000810009057971,0.000867866847826,0.000925724637681,0.000983582427536,0.001041440217391,0.001099298007246,0.001157155797101,0.001215013586957,0.001272871376812,0.001330729166667,0.001277500000000,0.001224270833333,0.001171041666667,0.001117812500000,0.001064583333333,0.001011354166667,0.000958125000000,0.000904895833333,0.000851666666667,0.000798437500000,0.000745208333333,0.000691979166667,0.000638750000000,0.000585520833333,0.000532291666667,0.000479062500000,0.000425833333333,0.000372604166667,0.000319375000000,0.000266145833333,0.000212916666667,0.000159687500000,0.000106458333333,0.000053229166667,0.000050098039216,0.000100196078431,0.000150294117647,0.000200392156863,0.000250490196078,0.000300588235294,0.000350686274510,0.000400784313725,0.000450882352941,0.000500980392157,0.000551078431373,0.000601176470588,0.000651274509804,0.000701372549020,0.000751470588235,0.000801568627451,0.000851666666667,0.000901764705882,0.000951862745098,0.001001960784314,0.001052058823529,0.001102156862745,0.001152254901961,0.001202352941176,0.001252450980392,0.001204279788839,0.001156108597285,0.001107937405732,0.001059766214178,0.001011595022624,0.000963423831071,0.000915252639517,0.000867081447964,0.000818910256410,0.000770739064857,0.000722567873303,0.000674396681750,0.000626225490196,0.000578054298643,0.000529883107089,0.000481711915535,0.000433540723982,0.000385369532428,0.000337198340875,0.000289027149321,0.000240855957768,0.000192684766214,0.000144513574661,0.000096342383107,0.000048171191554,0.000045495014245,0.000090990028490,0.000136485042735,0.000181980056980,0.000227475071225,0.000272970085470,0.000318465099715,0.000363960113960,0.000409455128205,0.000454950142450,0.000500445156695,0.000545940170940,0.000591435185185,0.000636930199430,0.000682425213675,0.000727920227920,0.000773415242165,0.000818910256410,0.000864405270655,0.000909900284900,0.000955395299145,0.001000890313390,0.001046385327635,0.001091880341880,0.001137375356125,0.001182870370370,0.001140625000000,0.001098379629630,0.001056134259259,0.001013888888889,0.000971643518519,0.000929398148148,0.000887152777778,0.000844907407407,0.000802662037037,0.000760416666667,0.000718171296296,0.000675925925926,0.000633680555556,0.000591435185185,0.000549189814815,0.000506944444444,0.000464699074074,0.000422453703704,0.000380208333333,0.000337962962963,0.000295717592593,0.000253472222222,0.000211226851852,0.000168981481481,0.000126736111111,0.000084490740741,0.000042245370370,0.000038665254237,0.000077330508475,0.000115995762712,0.000154661016949,0.000193326271186,0.000231991525424,0.000270656779661,0.000309322033898,0.000347987288136,0.000386652542373,0.000425317796610,0.000463983050847,0.000502648305085,0.000541313559322,0.000579978813559,0.000618644067797,0.000657309322034,0.000695974576271,0.000734639830508,0.000773305084746,0.000811970338983,0.000850635593220,0.000889300847458,0.000927966101695,0.000966631355932,0.001005296610169,0.001043961864407,0.001082627118644,0.001047703663204,0.001012780207764,0.000977856752324,0.000942933296884,0.000908009841443,0.000873086386003,0.000838162930563,0.000803239475123,0.000768316019683,0.000733392564243,0.000698469108803,0.000663545653362,0.000628622197922,0.000593698742482,0.000558775287042,0.000523851831602,0.000488928376162,0.000454004920722,0.000419081465282,0.000384158009841,0.000349234554401,0.000314311098961,0.000279387643521,0.000244464188081,0.000209540732641,0.000174617277201,0.000139693821761,0.000104770366320,0.000069846910880,0.000034923455440,0.000032706093190,0.000065412186380,0.000098118279570,0.000130824372760,0.000163530465950,0.000196236559140,0.000228942652330,0.000261648745520,0.000294354838710,0.000327060931900,0.000359767025090,0.000392473118280,0.000425179211470,0.000457885304659,0.000490591397849,0.000523297491039,0.000556003584229,0.000588709677419,0.000621415770609,0.000654121863799,0.000686827956989,0.000719534050179,0.000752240143369,0.000784946236559,0.000817652329749,0.000850358422939,0.000883064516129,0.000915770609319,0.000948476702509,0.000981182795699,0.001013888888889,0.000982204861111,0.000950520833333,0.000918836805556,0.000887152777778,0.000855468750000,0.000823784722222,0.000792100694444,0.000760416666667,0.000728732638889,0.000697048611111,0.000665364583333,0.000633680555556,0.000601996527778,0.000570312500000,0.000538628472222,0.000506944444444,0.000475260416667,0.000443576388889,0.000411892361111,0.000380208333333,0.000348524305556,0.000316840277778,0.000285156250000,0.000253472222222,0.000221788194444,0.000190104166667,0.000158420138889,0.000126736111111,0.000095052083333,0.000063368055556,0.000031684027778,0.000030243844697,0.000060487689394,0.000090731534091,0.000120975378788,0.000151219223485,0.000181463068182,0.000211706912879,0.000241950757576,0.000272194602273,0.000302438446970,0.000332682291667,0.000362926136364,0.000393169981061,0.000423413825758,0.000453657670455,0.000483901515152,0.000514145359848,0.000544389204545,0.000574633049242,0.000604876893939,0.000635120738636,0.000665364583333,0.000695608428030,0.000725852272727,0.000756096117424,0.000786339962121,0.000816583806818,0.000846827651515,0.000877071496212,0.000907315340909,0.000937559185606,0.000967803030303,0.000939338235294,0.000910873440285,0.000882408645276,0.000853943850267,0.000825479055258,0.000797014260250,0.000768549465241,0.000740084670232,0.000711619875223,0.000683155080214,0.000654690285205,0.000626225490196,0.000597760695187,0.000569295900178,0.000540831105169,0.000512366310160,0.000483901515152,0.000455436720143,0.000426971925134,0.000398507130125,0.000370042335116,0.000341577540107,0.000313112745098,0.000284647950089,0.000256183155080,0.000227718360071,0.000199253565062,0.000170788770053,0.000142323975045,0.000113859180036,0.000085394385027,0.000056929590018,0.000028464795009};
+static nnModelStatus_t readModelFile(const char *filename, uint32_t *image, nnModel_t *model, uint32_t numberOfInputs)
+{
+    FIL file;
+    UINT bytesRead = 0;
 
+    if (f_open(&file, filename, FA_READ) != FR_OK) return NN_MODEL_MISSING;
 
-	static float32_t preDCT[NBANKS-1] = {0};
-    int16_t punt = 0;
-    for (int ibank = 0; ibank < NBANKS-1; ibank += 1){
-    	float32_t sum = 0;
-    	for (int i = 0; i < infoH[ibank][1]; i += 1){
-    		sum = sum + (*(postFFT+infoH[ibank][0]+i)) * hbank[i+punt];
-    	}
-    	punt = punt + infoH[ibank][1];
-    	preDCT[ibank] = (float32_t)log10((double)sum);
-    }
+    FRESULT result = f_read(&file, image, NN_MODEL_MAXIMUM_SIZE, &bytesRead);
+    bool fileTooLarge = f_size(&file) > NN_MODEL_MAXIMUM_SIZE;
+    f_close(&file);
 
-    // 4: Perform DCT to obtain MFCCs
-    DCTII(preDCT, bufferOUT);
+    return result != FR_OK || fileTooLarge ? NN_MODEL_WRONG_SIZE : NNModel_parse(model, image, bytesRead, numberOfInputs);
 }
 
-
 /* 
- * Function: DCTII
- * Purpose: Perform Discrete Cosine Transform (DCT-II) on the input data.
- * 
+ * Function:  LoadNNModel
+ * Purpose:   Read the neural network model from "NN_MODEL.bin" on the SD
+ *            card, once per boot, so that a new model does not need a
+ *            firmware rebuild. If the file is missing or fails its checks,
+ *            the model compiled into the firmware is used. If the card
+ *            also holds a valid "NN_CONFIRM.bin", the detector runs as a
+ *            cascade with it as the confirmer.
+ *
  * Steps:
- * 1. Iterate through each DCT coefficient (k).
- * 2. For each coefficient, compute the weighted sum of input values.
- * 
- * Parameters:
- *  - indct: Pointer to input data for DCT.
- *  - outdct: Pointer to output data for the transformed values.
+ *   1. Select the built-in model.
+ *   2. Read and validate "NN_MODEL.bin" with readModelFile().
+ *   3. Read and validate "NN_CONFIRM.bin", whose input is the MFCC window.
+ *   4. Log the models used to "log.txt".
+ *
+ * Parameters: None (uses the globals neuralNetworkModel and confirmerModel).
  */
-static void DCTII(float32_t *indct, float32_t *outdct){
-	static const float32_t W = 0.223606797749979;
-	static const float32_t t = 0.039269908169872;
-
-	for (int k = 1; k < NUMBER_OF_SAMPLES_IN_BUFFERS_MFCC + 1; k += 1){
-		float32_t sum = 0;
-		for (int n = 0; n < NBANKS-1; n+= 1){
-		    sum = sum + *(indct+n)*arm_cos_f32((2*n+1)*k*t);
-		}
-
-		*(outdct+k-1) = W * sum;
-	}
-}
+void LoadNNModel(void)
+{
+    static char message[96];
 
-/* 
- * Function: deltas
- * Purpose: Calculate the delta (time-derivative) features from the MFCCs.
- * 
- * Steps:
- * 1. Initialize matrix instances for MFCCs and weighted matrices.
- * 2. Scale and add matrices to compute the deltas.
- * 
- * Parameters:
- *  - Dbuffers: Pointer to the MFCC buffers (2D array).
- */
-static void deltas(float32_t **Dbuffers){
-
-	// Initialize matrices for MFCCs and weighted values
-	uint8_t srcRows = NUMBER_OF_SAMPLES_IN_BUFFERS_MFCC;
-	uint8_t srcColumns = 1;
-	arm_matrix_instance_f32 M0;
-	arm_matrix_instance_f32 M1;
-	arm_matrix_instance_f32 M2;
-	arm_matrix_instance_f32 M3;
-	arm_matrix_instance_f32 M4;
-	arm_matrix_instance_f32 M0K;
-	arm_matrix_instance_f32 M1K;
-	arm_matrix_instance_f32 M3K;
-	arm_matrix_instance_f32 M4K;
-	arm_matrix_instance_f32 MDELT;
-
-	arm_mat_init_f32(&M0, srcRows, srcColumns, *Dbuffers);
-	arm_mat_init_f32(&M1, srcRows, srcColumns, *(Dbuffers + 1));
-	arm_mat_init_f32(&M2, srcRows, srcColumns, *(Dbuffers + 2));
-	arm_mat_init_f32(&M3, srcRows, srcColumns, *(Dbuffers + 3));
-	arm_mat_init_f32(&M4, srcRows, srcColumns, *(Dbuffers + 4));
-	arm_mat_init_f32(&MDELT, srcRows, srcColumns, *(Dbuffers + 2) + NUMBER_OF_SAMPLES_IN_BUFFERS_MFCC);
-
-	arm_mat_init_f32(&M4K, srcRows, srcColumns, MK4);
-	arm_mat_init_f32(&M3K, srcRows, srcColumns, MK3);
-	arm_mat_init_f32(&M1K, srcRows, srcColumns, MK1);
-	arm_mat_init_f32(&M0K, srcRows, srcColumns, MK0);
-
-    // Define scaling factors for deltas
-	const float32_t scalep1 = 0.1;
-	const float32_t scalep2 = 0.2;
-	const float32_t scalen1 = -0.1;
-	const float32_t scalen2 = -0.2;
-
-    // Scale the matrices
-	arm_mat_scale_f32 (&M0,scalen2, &M0K);
-	arm_mat_scale_f32 (&M1,scalen1, &M1K);
-	arm_mat_scale_f32 (&M3,scalep1, &M3K);
-	arm_mat_scale_f32 (&M4,scalep2, &M4K);
-
-    // Add the scaled matrices to compute the deltas
-	arm_mat_add_f32 (&M0K,&M4K,&M0K);
-	arm_mat_add_f32 (&M1K,&M3K,&M1K);
-	arm_mat_add_f32 (&M0K,&M1K,&MDELT);
+    if (neuralNetworkModelLoaded) return;   // Already loaded since boot
 
-}
+    neuralNetworkModelLoaded = true;
 
-/* 
- * Function: neuralNetwork
- * Purpose: Compute the output probability of the neural network given MFCCs as input.
- * 
- * Steps:
- * 1. Perform matrix multiplication for the input and hidden layer.
- * 2. Add biases and apply activation (tansig function).
- * 3. Perform matrix multiplication for the output layer.
- * 4. Add biases and apply softmax to compute probabilities.
- * 
- * Parameters:
- *  - bufferMFCC: Pointer to the input MFCC data.
- * 
- * Returns:
- *  - Output probability for the target class.
- */
-static float32_t neuralNetwork(float32_t *bufferMFCC){
-
-    // Define weights and biases for the neural network (extracted from MATLAB)	
-	/*static const float32_t b1[2] = {-1.6506595038998270741, 1.0714025936080897594};
-	static const float32_t b2[2] = {0.71983910097112435711, 0.42310377090373713083};
-	
-	static const float32_t A1[48] = {-0.14701604449555649712, 0.012510029384784456669, -0.10765188152252687381, 0.071180338776944462875, 0.061337039759318652543, 0.07557964594909946654, -0.052529524209502437282, -0.18343187601660726482, -0.028753465003183625859, 0.14929364750239063064, -0.22476698332039823924, 0.22934918030278503287, -0.05035400237997162548, -0.15055370722294802999, -0.3923630242629779219, -0.13481919076067130914, -0.63449351419339827807, 0.56403213635115156954, 0.21292134952589161778, 0.057119735283437930717, -0.22679689855485193895, 0.045036925887866785523, -0.32470570602237780466, -0.018139349505913043153, 0.68511045408493331799, 0.49584749848072662282, 0.67755136527226134113, 0.069789348142964946486, -0.48259518349628083289, 0.31833828044030243465, -0.36685163332242770595, 0.32092691603317674565, -0.031015556069871316747, -0.096091285828796710322, -0.19435447514644649258, -0.15616056365643254944, -0.15479064083304672206, -0.14544622046057389952, -0.029775084319359788887, -0.25126427067816187177, 0.24481594574285836519, 0.47007313654123988877, 0.10662993499324295577, 0.57975668297760285519, 0.30475582538514162101, 0.11974450165227325249, 0.57213684340161352626, 0.51677005424638533526};
-	
-	static const float32_t A2[4] = {-0.14048335432837033565, -1.3336896431931430929, -0.35913970340071038612, 0.34787595174652785612};*/
-	
-	//NN24
-	static const float32_t b1[2] = {1.8916010551494097935, 2.0087474377775778045};
-	static const float32_t b2[2] = {-0.089268169590198245822, 0.52228923760607492977};
-	
-	static const float32_t A1[48] = {0.1998886754907664709, 0.57158025640225418318, 0.073053558551228664486, 0.30815336956943989444, -0.36003003489407331417, 0.35955390517506552461, -0.55180303576284406297, 0.36854512746086781627, -0.11990989497331375202, -0.12415192057333071518, -0.11036941186308167617, 0.17488461021140797036, -0.013529466284958970024 ,-0.14750359472676494166, 0.055395201464141327619, 0.37214938872552660865, -0.24550221656609863552, 0.26630143218921387138, -0.47940732926561213656, -0.50824973434697218178, 0.38211640719584838433, 0.62598088027513776321, 0.23283702476734549625, 0.67685222502032615921, -0.58969760140591542807, 0.13612969647931399964, 0.28130343863305534713, 0.44360322873237156838, 0.025224012033459614068, -0.40590449389022426052, 1.1143112752679664723, -0.2161903374887501339, 0.23162703430932926607, -0.32741518794124441216 ,0.47349665037919996813, -0.45920452643889042577, -0.14105785899327966115, 0.031379435557255155875, 0.35720107620842272977, 0.21229694142108621047, -0.20368656129300038993, 0.1738414724904205344, -0.35063776391904794005, -0.6775042296727354918, -0.17173184806768476696, 0.46230394894357262903, 0.14771323500073230139, 0.79802613525304866293};
-	static const float32_t A2[4] = {-0.44486678654834321822, 1.1688121908846942354, 1.0641647684820378927, -0.85051800764122009735};
-	
-	/*//NN19
-	static const float32_t b1[2] = {-1.5661133609240214248,-1.1406531273477942268};
-	static const float32_t b2[2] = {0.45140415789782178946, -0.33536239791663619014};
-	static const float32_t A1[48] = {-0.55748386160543517143, -0.57036234155843101856, -0.72284137160577877079, -0.37548718467370523211, 0.36092292882579729563, -0.28514245081754102662, 0.42497412591292216266, -0.31394693935575268551, -0.17873072483802326937, 0.028673240732607310766, 0.27273497109910088687, -0.034465147575026784665, 0.091280970650085724305, 0.16246837970523822503, 0.42420799994186431103, -0.15650898723919640099, 0.55818619091595422788, -0.077484019070994655798, 0.37656602460363564067, 0.3824602828285871281, 0.26079610729213642539, -0.11807083858732858594, -0.35430291827638149549, -0.79129374012145103912, 0.36830164753197502936, -0.063131979380665392831, 0.10971586066140517901, -0.0037888611171126088117, -0.21410533481169460868, 0.28476284263704798594, -0.024944218677557646047, 0.22302273286132928698, 0.083820500309597908983, -0.17322889054456716562, 0.092818456838724083813, -0.0012995107758748680737, -0.071066923008439336629, -0.025098817661353089309, -0.17133312947158935158, 0.37262776443408884841, 0.074355463504859414803, -0.65961513108826397289, 0.073316542498309864029, -0.21638519063280908794, -0.61801039856739148348, 0.046369015900059235014, -0.65507058233604120723, 0.24374648877628896093};
-	static const float32_t A2[4] = {0.55614365078854488544, 0.48908670100944617865,-1.1617123747462525518, 1.136551899847834779};*/
-	
-	float32_t L1[2]; // Hidden layer outputs
-	float32_t L2[2]; // Output layer outputs
-
-    // Initialize matrices for the neural network
-	arm_matrix_instance_f32 Minput;
-	arm_matrix_instance_f32 MA1;
-	arm_matrix_instance_f32 Mb1;
-	arm_matrix_instance_f32 MA2;
-	arm_matrix_instance_f32 Mb2;
-	arm_matrix_instance_f32 ML1;
-	arm_matrix_instance_f32 ML2;
-
-
-	uint8_t rows = 2;
-	uint8_t columns = 2*NUMBER_OF_SAMPLES_IN_BUFFERS_MFCC;
-	uint8_t srcRows = NUMBER_OF_SAMPLES_IN_BUFFERS_MFCC;
-	uint8_t srcColumns = 1;
-
-	arm_status status;
-	arm_mat_init_f32(&Minput, 2*srcRows, srcColumns, bufferMFCC);
-	arm_mat_init_f32(&MA1, rows, columns, A1);
-	arm_mat_init_f32(&Mb1, rows, srcColumns, b1);
-	arm_mat_init_f32(&MA2, rows, 2*srcColumns, A2);
-	arm_mat_init_f32(&Mb2, rows, srcColumns, b2);
-	arm_mat_init_f32(&ML1, rows, srcColumns, L1);
-	arm_mat_init_f32(&ML2, rows, srcColumns, L2);
-
-	//Input and hidden layer computations
-	status = arm_mat_mult_f32 (&MA1,&Minput,&ML1);
-
-	if(ARM_MATH_SUCCESS == 1){
-		FLASH_LED(Both, LONG_LED_FLASH_DURATION);
-	}
-
-	arm_mat_add_f32 (&Mb1,&ML1,&ML1);
-
-	// Apply tansig activation
-	for (int i = 0; i < 2; i += 1 ){
-		L1[i] = 2 / (1 + exp(-2*L1[i])) - 1;
-	}
-
-	//Output layer computation
-	arm_mat_mult_f32 (&MA2,&ML1,&ML2);
-
-	arm_mat_add_f32 (&Mb2,&ML2,&ML2);
-
-	// Apply Softmax activation
-	float32_t expo;
-	expo = exp(L2[0]);
-
-	return expo/(exp(L2[1])+expo);
+    NNModel_loadDefault(&neuralNetworkModel);
+
+    nnModelStatus_t status = readModelFile(NN_MODEL_FILENAME, neuralNetworkModelImage, &neuralNetworkModel, NUMBER_OF_FEATURES);
+
+    if (status == NN_MODEL_OK) {
+        sprintf(message, "Loaded %s (CRC %08lX)\n", NN_MODEL_FILENAME, neuralNetworkModel.crc);
+        writeLog(message);
+    } else if (status != NN_MODEL_MISSING) {
+        sprintf(message, "Warning: %s rejected (%s), using the built-in model\n", NN_MODEL_FILENAME, NNModel_describeStatus(status));
+        writeLog(message);
+    }
 
+    status = readModelFile(NN_CONFIRMER_FILENAME, confirmerModelImage, &confirmerModel, NN_CONFIRMER_NUMBER_OF_FEATURES);
+
+    cascadeEnabled = status == NN_MODEL_OK;
+
+    if (status == NN_MODEL_OK) {
+        int preScaled = (int)(NN_PRETHRESHOLD * 100 + 0.5f);
+        sprintf(message, "Loaded %s (CRC %08lX), cascade pre-threshold %d.%02d\n", NN_CONFIRMER_FILENAME, confirmerModel.crc, preScaled / 100, preScaled % 100);
+        writeLog(message);
+    } else if (status != NN_MODEL_MISSING) {
+        sprintf(message, "Warning: %s rejected (%s), cascade disabled\n", NN_CONFIRMER_FILENAME, NNModel_describeStatus(status));
+        writeLog(message);
+    }
 }
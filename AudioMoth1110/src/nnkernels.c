@@ -0,0 +1,86 @@
+/****************************************************************************
+ * nnkernels.c
+ * openacousticdevices.info
+ * October 2026
+ *****************************************************************************/
+
+/* Generated by host/tablegen.c - do not edit */
+
+#include <stddef.h>
+
+#include "nnkernels.h"
+
+/* 24 inputs, 2 outputs */
+
+static void denseLayer24x2(const float32_t *weights, const float32_t *biases, const float32_t *input, float32_t *output) {
+
+    float32_t x, a0, a1;
+
+    a0 = biases[0];
+    a1 = biases[1];
+    x = input[0]; a0 += weights[0] * x; a1 += weights[24] * x;
+    x = input[1]; a0 += weights[1] * x; a1 += weights[25] * x;
+    x = input[2]; a0 += weights[2] * x; a1 += weights[26] * x;
+    x = input[3]; a0 += weights[3] * x; a1 += weights[27] * x;
+    x = input[4]; a0 += weights[4] * x; a1 += weights[28] * x;
+    x = input[5]; a0 += weights[5] * x; a1 += weights[29] * x;
+    x = input[6]; a0 += weights[6] * x; a1 += weights[30] * x;
+    x = input[7]; a0 += weights[7] * x; a1 += weights[31] * x;
+    x = input[8]; a0 += weights[8] * x; a1 += weights[32] * x;
+    x = input[9]; a0 += weights[9] * x; a1 += weights[33] * x;
+    x = input[10]; a0 += weights[10] * x; a1 += weights[34] * x;
+    x = input[11]; a0 += weights[11] * x; a1 += weights[35] * x;
+    x = input[12]; a0 += weights[12] * x; a1 += weights[36] * x;
+    x = input[13]; a0 += weights[13] * x; a1 += weights[37] * x;
+    x = input[14]; a0 += weights[14] * x; a1 += weights[38] * x;
+    x = input[15]; a0 += weights[15] * x; a1 += weights[39] * x;
+    x = input[16]; a0 += weights[16] * x; a1 += weights[40] * x;
+    x = input[17]; a0 += weights[17] * x; a1 += weights[41] * x;
+    x = input[18]; a0 += weights[18] * x; a1 += weights[42] * x;
+    x = input[19]; a0 += weights[19] * x; a1 += weights[43] * x;
+    x = input[20]; a0 += weights[20] * x; a1 += weights[44] * x;
+    x = input[21]; a0 += weights[21] * x; a1 += weights[45] * x;
+    x = input[22]; a0 += weights[22] * x; a1 += weights[46] * x;
+    x = input[23]; a0 += weights[23] * x; a1 += weights[47] * x;
+    output[0] = a0;
+    output[1] = a1;
+
+}
+
+/* 2 inputs, 2 outputs */
+
+static void denseLayer2x2(const float32_t *weights, const float32_t *biases, const float32_t *input, float32_t *output) {
+
+    float32_t x, a0, a1;
+
+    a0 = biases[0];
+    a1 = biases[1];
+    x = input[0]; a0 += weights[0] * x; a1 += weights[2] * x;
+    x = input[1]; a0 += weights[1] * x; a1 += weights[3] * x;
+    output[0] = a0;
+    output[1] = a1;
+
+}
+
+/* Kernels by layer shape */
+
+static const struct {
+    uint16_t numberOfInputs;
+    uint16_t numberOfOutputs;
+    nnKernel_t kernel;
+} kernels[2] = {
+    {24, 2, denseLayer24x2},
+    {2, 2, denseLayer2x2}
+};
+
+nnKernel_t NNKernels_find(uint32_t numberOfInputs, uint32_t numberOfOutputs) {
+
+    for (uint32_t i = 0; i < 2; i += 1) {
+
+        if (kernels[i].numberOfInputs == numberOfInputs && kernels[i].numberOfOutputs == numberOfOutputs) return kernels[i].kernel;
+
+    }
+
+    return NULL;
+
+}
@@ -0,0 +1,309 @@
+/****************************************************************************
+ * nnmodel.c
+ * openacousticdevices.info
+ * October 2026
+ *****************************************************************************/
+
+#include <math.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "nnmodel.h"
+#include "nnkernels.h"
+
+/* CRC-32 polynomial, reflected, as used by zlib */
+
+#define CRC32_POLYNOMIAL                    0xEDB88320
+#define CRC32_INITIAL_VALUE                 0xFFFFFFFF
+
+/* Requantisation multipliers are Q31 mantissas applied with a rounding right shift */
+
+#define Q31_ONE                             2147483648.0f
+#define Q7_STEP                             (1.0f / 128.0f)
+#define MAXIMUM_REQUANTISATION_SHIFT        62
+
+#define ROUND_UP_TO_WORD(size)              (((size) + sizeof(uint32_t) - 1) & ~(sizeof(uint32_t) - 1))
+
+/* Built-in model (NN24): 24 features, 2 tansig hidden units and a 2-way softmax, from MATLAB/NeuralNetworkFunction.m */
+
+static const float32_t defaultA1[2 * NUMBER_OF_FEATURES] = {0.1998886754907664709, 0.57158025640225418318, 0.073053558551228664486, 0.30815336956943989444, -0.36003003489407331417, 0.35955390517506552461, -0.55180303576284406297, 0.36854512746086781627, -0.11990989497331375202, -0.12415192057333071518, -0.11036941186308167617, 0.17488461021140797036, -0.013529466284958970024 ,-0.14750359472676494166, 0.055395201464141327619, 0.37214938872552660865, -0.24550221656609863552, 0.26630143218921387138, -0.47940732926561213656, -0.50824973434697218178, 0.38211640719584838433, 0.62598088027513776321, 0.23283702476734549625, 0.67685222502032615921, -0.58969760140591542807, 0.13612969647931399964, 0.28130343863305534713, 0.44360322873237156838, 0.025224012033459614068, -0.40590449389022426052, 1.1143112752679664723, -0.2161903374887501339, 0.23162703430932926607, -0.32741518794124441216 ,0.47349665037919996813, -0.45920452643889042577, -0.14105785899327966115, 0.031379435557255155875, 0.35720107620842272977, 0.21229694142108621047, -0.20368656129300038993, 0.1738414724904205344, -0.35063776391904794005, -0.6775042296727354918, -0.17173184806768476696, 0.46230394894357262903, 0.14771323500073230139, 0.79802613525304866293};
+
+static const float32_t defaultb1[2] = {1.8916010551494097935, 2.0087474377775778045};
+
+static const float32_t defaultA2[4] = {-0.44486678654834321822, 1.1688121908846942354, 1.0641647684820378927, -0.85051800764122009735};
+
+static const float32_t defaultb2[2] = {-0.089268169590198245822, 0.52228923760607492977};
+
+static const nnModel_t defaultModel = {
+    .numberOfLayers = 2,
+    .numberOfClasses = 2,
+    .crc = 0,
+    .encoding = NN_FLOAT32,
+    .layers = {
+        {.numberOfInputs = NUMBER_OF_FEATURES, .numberOfOutputs = 2, .activation = NN_TANSIG, .weights = defaultA1, .biases = defaultb1},
+        {.numberOfInputs = 2, .numberOfOutputs = 2, .activation = NN_SOFTMAX, .weights = defaultA2, .biases = defaultb2}
+    }
+};
+
+static const char *statusDescriptions[NUMBER_OF_NN_MODEL_STATUSES] = {"OK", "wrong size", "not a model file", "unsupported version", "CRC mismatch", "unsupported layer shape", "file not found"};
+
+/* 
+ * Function: NNModel_crc32
+ * Purpose: Compute the CRC-32 of a block of bytes, bit by bit as the model
+ *          is only checked once when it is loaded.
+ * 
+ * Parameters:
+ *  - data: Pointer to the bytes.
+ *  - size: Number of bytes.
+ * 
+ * Returns:
+ *  - The CRC-32, equal to zlib.crc32(data).
+ */
+uint32_t NNModel_crc32(const uint8_t *data, uint32_t size) {
+
+    uint32_t crc = CRC32_INITIAL_VALUE;
+
+    for (uint32_t i = 0; i < size; i += 1) {
+
+        crc ^= data[i];
+
+        for (uint32_t bit = 0; bit < 8; bit += 1) {
+
+            crc = crc & 1 ? (crc >> 1) ^ CRC32_POLYNOMIAL : crc >> 1;
+
+        }
+
+    }
+
+    return ~crc;
+
+}
+
+/* Requantisation of an int8 layer: the accumulators, in units of inputScale * weightScale, are
+ * converted to the units of the activation table or, for linear layers, of the layer outputs */
+
+static bool setRequantisation(nnLayer_t *layer, const nnModelQuantisation_t *quantisation) {
+
+    if (!(quantisation->inputScale > 0.0f) || !(quantisation->weightScale > 0.0f)) return false;
+
+    layer->accumulatorScale = quantisation->inputScale * quantisation->weightScale;
+
+    float32_t outputStep = layer->activation == NN_TANSIG ? NN_TANSIG_TABLE_STEP : layer->activation == NN_SOFTMAX ? NN_SOFTMAX_TABLE_STEP : quantisation->outputScale;
+
+    float32_t factor = layer->accumulatorScale / outputStep;
+
+    if (!(factor > 0.0f) || !isfinite(factor)) return false;
+
+    int exponent;
+
+    float32_t mantissa = frexpf(factor, &exponent);
+
+    layer->multiplier = (int32_t)(mantissa * Q31_ONE);
+
+    layer->shift = 31 - exponent;
+
+    return layer->shift >= 1 && layer->shift <= MAXIMUM_REQUANTISATION_SHIFT;
+
+}
+
+/* 
+ * Function: NNModel_parse
+ * Purpose: Validate a model image read from the model file and describe its
+ *          layers without copying the weights.
+ * 
+ * Steps:
+ * 1. Check the size, magic number, version and CRC of the image.
+ * 2. Walk the layers, checking that each one consumes the outputs of the
+ *    previous one (the first one the given number of inputs), fits the
+ *    network scratch and has a known activation, and give each temporal
+ *    layer its ring in the temporal state.
+ * 3. For the float32 encoding, attach the unrolled kernel generated for
+ *    the shape of each layer, if any. For the int8 encoding, check that
+ *    the input scale of each layer is the step of the outputs of the
+ *    previous one (Q7 after tansig, the output scale after a linear layer),
+ *    and derive the requantisation of each layer from its scales once here
+ *    rather than per frame.
+ * 4. Check that the layers fill the image exactly and that the outputs of
+ *    the last one, the classes, do not exceed NN_MAXIMUM_NUMBER_OF_CLASSES.
+ * 
+ * Parameters:
+ *  - model: Pointer to the model to describe. It is left unchanged on error.
+ *  - image: Pointer to the word aligned image of the model file.
+ *  - size: Size of the image in bytes.
+ *  - numberOfInputs: Inputs the model must take, NUMBER_OF_FEATURES for
+ *    the per-frame model and NN_CONFIRMER_NUMBER_OF_FEATURES for the
+ *    confirmer of the cascade.
+ * 
+ * Returns:
+ *  - NN_MODEL_OK, or the reason why the image was rejected.
+ */
+nnModelStatus_t NNModel_parse(nnModel_t *model, const uint32_t *image, uint32_t size, uint32_t numberOfInputs) {
+
+    const uint8_t *bytes = (const uint8_t*)image;
+
+    nnModelHeader_t header;
+
+    if (size < sizeof(nnModelHeader_t) + sizeof(uint32_t) || size > NN_MODEL_MAXIMUM_SIZE || size % sizeof(uint32_t) != 0) return NN_MODEL_WRONG_SIZE;
+
+    memcpy(&header, bytes, sizeof(nnModelHeader_t));
+
+    if (header.magic != NN_MODEL_MAGIC) return NN_MODEL_WRONG_MAGIC;
+
+    if (header.version == 0 || header.version > NN_MODEL_VERSION) return NN_MODEL_WRONG_VERSION;
+
+    if (header.layersSize != size - sizeof(nnModelHeader_t) - sizeof(uint32_t)) return NN_MODEL_WRONG_SIZE;
+
+    uint32_t crc = image[size / sizeof(uint32_t) - 1];
+
+    if (NNModel_crc32(bytes, size - sizeof(uint32_t)) != crc) return NN_MODEL_WRONG_CRC;
+
+    if (header.numberOfLayers == 0 || header.numberOfLayers > NN_MAXIMUM_NUMBER_OF_LAYERS || header.numberOfInputs != numberOfInputs || header.encoding >= NUMBER_OF_NN_ENCODINGS) return NN_MODEL_WRONG_SHAPE;
+
+    /* Describe the layers in a copy so that the model is only changed if the whole image is valid */
+
+    nnModel_t parsed = {.numberOfLayers = header.numberOfLayers, .crc = crc, .encoding = (nnEncoding_t)header.encoding};
+
+    uint32_t offset = sizeof(nnModelHeader_t);
+
+    float32_t outputStep = 0.0f;
+
+    for (uint32_t i = 0; i < header.numberOfLayers; i += 1) {
+
+        nnModelLayerHeader_t layerHeader;
+
+        if (offset + sizeof(nnModelLayerHeader_t) > size - sizeof(uint32_t)) return NN_MODEL_WRONG_SIZE;
+
+        memcpy(&layerHeader, bytes + offset, sizeof(nnModelLayerHeader_t));
+
+        offset += sizeof(nnModelLayerHeader_t);
+
+        if (layerHeader.numberOfInputs != numberOfInputs || layerHeader.numberOfOutputs == 0 || layerHeader.numberOfOutputs > NN_MAXIMUM_LAYER_WIDTH || layerHeader.activation >= NUMBER_OF_NN_ACTIVATIONS) return NN_MODEL_WRONG_SHAPE;
+
+        /* The taps and the dilation were reserved bytes before version 2, so a version 1 layer must leave them zero */
+
+        if (header.version < NN_MODEL_TEMPORAL_VERSION && (layerHeader.numberOfTaps != 0 || layerHeader.dilation != 0 || layerHeader.reserved != 0)) return NN_MODEL_WRONG_SHAPE;
+
+        uint32_t numberOfTaps = layerHeader.numberOfTaps > 1 ? layerHeader.numberOfTaps : 1;
+
+        uint32_t dilation = layerHeader.dilation > 1 ? layerHeader.dilation : 1;
+
+        if (numberOfTaps > NN_MAXIMUM_NUMBER_OF_TAPS || (numberOfTaps > 1 && parsed.encoding != NN_FLOAT32)) return NN_MODEL_WRONG_SHAPE;
+
+        /* Temporal layers need a run on every frame, so the confirmer of the cascade cannot have any */
+
+        if (numberOfTaps > 1 && header.numberOfInputs != NUMBER_OF_FEATURES) return NN_MODEL_WRONG_SHAPE;
+
+        uint32_t numberOfWeights = numberOfTaps * layerHeader.numberOfOutputs * layerHeader.numberOfInputs;
+
+        uint32_t layerSize = parsed.encoding == NN_FLOAT32 ? (numberOfWeights + layerHeader.numberOfOutputs) * sizeof(float32_t) : sizeof(nnModelQuantisation_t) + layerHeader.numberOfOutputs * sizeof(int32_t) + ROUND_UP_TO_WORD(numberOfWeights);
+
+        if (offset + layerSize > size - sizeof(uint32_t)) return NN_MODEL_WRONG_SIZE;
+
+        nnLayer_t *layer = parsed.layers + i;
+
+        layer->numberOfInputs = layerHeader.numberOfInputs;
+
+        layer->numberOfOutputs = layerHeader.numberOfOutputs;
+
+        layer->activation = (nnActivation_t)layerHeader.activation;
+
+        layer->numberOfTaps = numberOfTaps;
+
+        layer->dilation = dilation;
+
+        if (numberOfTaps > 1) {
+
+            layer->stateOffset = parsed.temporalStateSize;
+
+            layer->numberOfStateFrames = (numberOfTaps - 1) * dilation + 1;
+
+            parsed.temporalStateSize += layer->numberOfStateFrames * layer->numberOfInputs;
+
+            if (parsed.temporalStateSize > NN_TEMPORAL_STATE_SIZE) return NN_MODEL_WRONG_SHAPE;
+
+        }
+
+        if (parsed.encoding == NN_FLOAT32) {
+
+            layer->weights = (const float32_t*)(bytes + offset);
+
+            layer->biases = layer->weights + numberOfWeights;
+
+            if (numberOfTaps == 1) layer->kernel = NNKernels_find(layer->numberOfInputs, layer->numberOfOutputs);
+
+        } else {
+
+            nnModelQuantisation_t quantisation;
+
+            memcpy(&quantisation, bytes + offset, sizeof(nnModelQuantisation_t));
+
+            layer->quantisedBiases = (const int32_t*)(bytes + offset + sizeof(nnModelQuantisation_t));
+
+            layer->quantisedWeights = (const q7_t*)(layer->quantisedBiases + layerHeader.numberOfOutputs);
+
+            if (layer->activation == NN_SOFTMAX && i + 1 < header.numberOfLayers) return NN_MODEL_WRONG_SHAPE;
+
+            if (i > 0 && quantisation.inputScale != outputStep) return NN_MODEL_WRONG_SHAPE;
+
+            if (!setRequantisation(layer, &quantisation)) return NN_MODEL_WRONG_SHAPE;
+
+            outputStep = layer->activation == NN_TANSIG ? Q7_STEP : quantisation.outputScale;
+
+            if (i == 0) parsed.inputInverseScale = 1.0f / quantisation.inputScale;
+
+        }
+
+        offset += layerSize;
+
+        numberOfInputs = layerHeader.numberOfOutputs;
+
+    }
+
+    if (offset != size - sizeof(uint32_t)) return NN_MODEL_WRONG_SIZE;
+
+    if (numberOfInputs > NN_MAXIMUM_NUMBER_OF_CLASSES) return NN_MODEL_WRONG_SHAPE;
+
+    parsed.numberOfClasses = numberOfInputs;
+
+    *model = parsed;
+
+    return NN_MODEL_OK;
+
+}
+
+/* 
+ * Function: NNModel_loadDefault
+ * Purpose: Describe the model compiled into the firmware, with the unrolled
+ *          kernels generated for its layer shapes.
+ * 
+ * Parameters:
+ *  - model: Pointer to the model to describe.
+ */
+void NNModel_loadDefault(nnModel_t *model) {
+
+    *model = defaultModel;
+
+    for (uint32_t i = 0; i < model->numberOfLayers; i += 1) {
+
+        model->layers[i].kernel = NNKernels_find(model->layers[i].numberOfInputs, model->layers[i].numberOfOutputs);
+
+    }
+
+}
+
+/* 
+ * Function: NNModel_describeStatus
+ * Purpose: Name the result of NNModel_parse for the log file.
+ * 
+ * Parameters:
+ *  - status: Result of NNModel_parse.
+ * 
+ * Returns:
+ *  - A constant string.
+ */
+const char* NNModel_describeStatus(nnModelStatus_t status) {
+
+    return status < NUMBER_OF_NN_MODEL_STATUSES ? statusDescriptions[status] : "unknown";
+
+}
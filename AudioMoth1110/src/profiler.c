@@ -0,0 +1,153 @@
+/****************************************************************************
+ * profiler.c
+ * openacousticdevices.info
+ * October 2026
+ *****************************************************************************/
+
+#include <stdio.h>
+#include <string.h>
+
+#include "profiler.h"
+
+/* Histogram constants: four bins per power of two, so percentiles are resolved to within 19% */
+
+#define BINS_PER_OCTAVE                     4
+#define BINS_PER_OCTAVE_SHIFT               2
+#define NUMBER_OF_HISTOGRAM_BINS            (32 * BINS_PER_OCTAVE)
+
+#define PERCENTILE                          99
+#define PERCENT                             100
+
+#define REPORT_LINE_LENGTH                  80
+
+/* Stage statistics */
+
+typedef struct {
+    uint32_t count;
+    uint32_t minimum;
+    uint32_t maximum;
+    uint64_t total;
+    uint32_t histogram[NUMBER_OF_HISTOGRAM_BINS];
+} stageStatistics_t;
+
+static stageStatistics_t statistics[NUMBER_OF_PROFILE_STAGES];
+
+/* Stage names, with the FFT and magnitude kernels of the front end in use (see detector.h) */
+
+#ifndef DETECTOR_FIXED_POINT
+
+static const char *stageNames[NUMBER_OF_PROFILE_STAGES] = {"Window", "arm_rfft_fast_f32", "arm_cmplx_mag_f32", "Filterbank", "log10", "DCTII", "deltas", "neuralNetwork", "Detector_confirm", "AudioMoth_writeToFile"};
+
+#else
+
+static const char *stageNames[NUMBER_OF_PROFILE_STAGES] = {"Window", "arm_rfft_q31", "arm_cmplx_mag_q31", "Filterbank", "log10", "DCTII", "deltas", "neuralNetwork", "Detector_confirm", "AudioMoth_writeToFile"};
+
+#endif
+
+/* Histogram bin functions */
+
+static uint32_t binOf(uint32_t ticks) {
+
+    if (ticks < BINS_PER_OCTAVE) return ticks;
+
+    uint32_t msb = 31 - __builtin_clz(ticks);
+
+    uint32_t fraction = (ticks >> (msb - BINS_PER_OCTAVE_SHIFT)) & (BINS_PER_OCTAVE - 1);
+
+    return (msb - BINS_PER_OCTAVE_SHIFT + 1) * BINS_PER_OCTAVE + fraction;
+
+}
+
+static uint32_t upperEdgeOf(uint32_t bin) {
+
+    if (bin < BINS_PER_OCTAVE) return bin;
+
+    uint32_t msb = bin / BINS_PER_OCTAVE + BINS_PER_OCTAVE_SHIFT - 1;
+
+    uint32_t fraction = bin % BINS_PER_OCTAVE;
+
+    uint64_t edge = ((uint64_t)(BINS_PER_OCTAVE + fraction + 1) << (msb - BINS_PER_OCTAVE_SHIFT)) - 1;
+
+    return edge > UINT32_MAX ? UINT32_MAX : (uint32_t)edge;
+
+}
+
+/* Public functions */
+
+void Profiler_reset(void) {
+
+    memset(statistics, 0, sizeof(statistics));
+
+#if defined(__arm__)
+
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+
+    DWT->CYCCNT = 0;
+
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+
+#endif
+
+}
+
+void Profiler_record(profileStage_t stage, uint32_t ticks) {
+
+    stageStatistics_t *s = statistics + stage;
+
+    if (s->count == 0 || ticks < s->minimum) s->minimum = ticks;
+
+    if (ticks > s->maximum) s->maximum = ticks;
+
+    s->total += ticks;
+
+    s->count += 1;
+
+    s->histogram[binOf(ticks)] += 1;
+
+}
+
+uint32_t Profiler_formatReport(char *buffer, uint32_t size) {
+
+    uint32_t length = 0;
+
+    if (size < REPORT_LINE_LENGTH) return 0;
+
+    length += sprintf(buffer + length, "%-22s %8s %10s %10s %10s %10s (%s)\r\n", "Stage", "Count", "Min", "Mean", "p99", "Max", PROFILER_UNITS);
+
+    for (uint32_t stage = 0; stage < NUMBER_OF_PROFILE_STAGES && length + REPORT_LINE_LENGTH < size; stage += 1) {
+
+        stageStatistics_t *s = statistics + stage;
+
+        if (s->count == 0) continue;
+
+        /* Percentile is reported as the upper edge of the bin that contains it */
+
+        uint32_t target = (uint32_t)(((uint64_t)s->count * PERCENTILE + PERCENT - 1) / PERCENT);
+
+        uint32_t cumulative = 0;
+
+        uint32_t bin = 0;
+
+        while (bin < NUMBER_OF_HISTOGRAM_BINS - 1) {
+
+            cumulative += s->histogram[bin];
+
+            if (cumulative >= target) break;
+
+            bin += 1;
+
+        }
+
+        uint32_t percentile = upperEdgeOf(bin);
+
+        if (percentile > s->maximum) percentile = s->maximum;
+
+        uint32_t mean = (uint32_t)(s->total / s->count);
+
+        length += sprintf(buffer + length, "%-22s %8lu %10lu %10lu %10lu %10lu\r\n", stageNames[stage], (unsigned long)s->count, (unsigned long)s->minimum, (unsigned long)mean, (unsigned long)percentile, (unsigned long)s->maximum);
+
+    }
+
+    return length;
+
+}
@@ -153,4 +153,8 @@ if (true)
     % network performs.
     genFunction(net,'NeuralNetworkFunction');
     save('tr') % Save the training record
+
+    % Export the network to the model file loaded by the firmware from
+    % the SD card (copy NN_MODEL.bin next to NN_CONFIG.txt)
+    system('python export_model.py --i NeuralNetworkFunction.m --o NN_MODEL.bin');
 end
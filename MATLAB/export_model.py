@@ -0,0 +1,142 @@
+# -*- coding: utf-8 -*-
+"""
+Export the network generated by b_trainNNmat.m (genFunction, NeuralNetworkFunction.m)
+to the binary model file read by the AudioMoth firmware from the SD card (NN_MODEL.bin)
+Modified: 2026
+"""
+
+import re
+import struct
+import zlib
+import argparse
+
+# ---------------------- MODEL FILE FORMAT ----------------------
+# Must match AudioMoth1110/inc/nnmodel.h
+
+NN_MODEL_MAGIC = 0x4E4E4D41          # "AMNN"
+NN_MODEL_VERSION = 2                 # version 1 files, without temporal layers, are still read
+NN_MODEL_MAXIMUM_SIZE = 4096
+NN_MAXIMUM_NUMBER_OF_LAYERS = 4
+NN_MAXIMUM_LAYER_WIDTH = 64
+NN_MAXIMUM_NUMBER_OF_CLASSES = 8
+NN_MAXIMUM_NUMBER_OF_TAPS = 8
+NN_TEMPORAL_STATE_SIZE = 512
+NUMBER_OF_FEATURES = 24                  # per-frame model: 12 MFCCs and 12 deltas
+NN_CONFIRMER_NUMBER_OF_FEATURES = 96     # cascade confirmer: 12 MFCCs averaged over 8 steps of 4 frames
+
+ACTIVATIONS = {'purelin': 0, 'tansig': 1, 'softmax': 2}
+ENCODINGS = {'float32': 0, 'int8': 1}
+
+# ---------------------- FUNCIONES ----------------------
+
+def parse_matrix(text):
+    """
+    Parse a MATLAB matrix literal such as [1 2;3 4] into a list of rows.
+    """
+    rows = [row.replace(',', ' ').split() for row in text.strip('[] ').split(';')]
+    return [[float(value) for value in row] for row in rows if row]
+
+def read_network_function(filename):
+    """
+    READ_NETWORK_FUNCTION Extracts the layers of a network from the function written by genFunction.
+    
+    Inputs:
+    - filename:  Path of NeuralNetworkFunction.m.
+    
+    Outputs:
+    - layers:    List of (weights, biases, activation) tuples, weights as rows of outputs x inputs.
+    """
+    with open(filename) as file:
+        source = file.read()
+
+    if re.search(r'\b[xy]1_step\d', source):
+        raise ValueError('input or output processing steps are not supported, train with net.input.processFcns = {} or remove them')
+
+    constants = {name: parse_matrix(value) for name, value in re.findall(r'^\s*((?:b|IW|LW)[\d_]+)\s*=\s*(\[[^\]]*\]);', source, re.M)}
+
+    layers = []
+    for index, activation, weights in re.findall(r'^\s*a(\d+)\s*=\s*(?:(\w+)_apply\()?\s*repmat\(b\d+,1,Q\)\s*\+\s*((?:IW|LW)\d+_\d+)\*', source, re.M):
+        layer = int(index)
+        if layer != len(layers) + 1:
+            raise ValueError('layers are not in order, or the network is not a feed-forward chain')
+        layers.append((constants[weights], [row[0] for row in constants['b%d' % layer]], activation or 'purelin'))
+
+    if not layers:
+        raise ValueError('no layers found in %s' % filename)
+
+    return layers
+
+def write_model(filename, layers, encoding='float32', parameters=None):
+    """
+    WRITE_MODEL Writes the layers in the binary model format, checking the limits of the firmware.
+    
+    Inputs:
+    - filename:   Path of the model file.
+    - layers:     List of (weights, biases, activation) tuples. The inputs of the first layer select the
+                  per-frame model (NN_MODEL.bin) or the confirmer of the cascade (NN_CONFIRM.bin).
+                  A temporal layer is a (taps, biases, activation, dilation) tuple, with one weight matrix
+                  per tap, tap 0 applied to the current frame and tap k to dilation * k frames before.
+    - encoding:   'float32', or 'int8' for the output of quantize_model.py.
+    - parameters: Packed parameters of each layer in the given encoding (default: float32 weights and biases).
+    
+    Outputs:
+    - crc:        CRC-32 of the model, as logged by the firmware.
+    """
+    layers = [layer if len(layer) == 4 else ([layer[0]], layer[1], layer[2], 1) for layer in layers]
+    inputs = len(layers[0][0][0][0])
+    if inputs not in (NUMBER_OF_FEATURES, NN_CONFIRMER_NUMBER_OF_FEATURES):
+        raise ValueError('%d inputs, the firmware expects %d (NN_MODEL.bin) or %d (NN_CONFIRM.bin)' % (inputs, NUMBER_OF_FEATURES, NN_CONFIRMER_NUMBER_OF_FEATURES))
+    payload = b''
+    state = 0
+    for index, (taps, biases, activation, dilation) in enumerate(layers):
+        outputs = len(taps[0])
+        if any(len(weights) != outputs or any(len(row) != inputs for row in weights) for weights in taps) or len(biases) != outputs:
+            raise ValueError('layer of %d outputs does not follow %d inputs' % (outputs, inputs))
+        if outputs > NN_MAXIMUM_LAYER_WIDTH or activation not in ACTIVATIONS:
+            raise ValueError('unsupported layer: %d %s outputs' % (outputs, activation))
+        if len(taps) > 1:
+            state += ((len(taps) - 1) * dilation + 1) * inputs
+            if len(taps) > NN_MAXIMUM_NUMBER_OF_TAPS or not 1 <= dilation <= 255 or encoding != 'float32' or len(layers[0][0][0][0]) != NUMBER_OF_FEATURES:
+                raise ValueError('unsupported temporal layer: %d taps, dilation %d, %s, only float32 per-frame models' % (len(taps), dilation, encoding))
+        payload += struct.pack('<HHBBBx', inputs, outputs, ACTIVATIONS[activation], len(taps) if len(taps) > 1 else 0, dilation if len(taps) > 1 else 0)
+        if parameters is None:
+            values = [value for weights in taps for row in weights for value in row] + list(biases)
+            payload += struct.pack('<%df' % len(values), *values)
+        else:
+            payload += parameters[index]
+        inputs = outputs
+
+    if len(layers) > NN_MAXIMUM_NUMBER_OF_LAYERS:
+        raise ValueError('%d layers, the firmware supports %d' % (len(layers), NN_MAXIMUM_NUMBER_OF_LAYERS))
+    if inputs > NN_MAXIMUM_NUMBER_OF_CLASSES:
+        raise ValueError('%d classes, the firmware supports %d' % (inputs, NN_MAXIMUM_NUMBER_OF_CLASSES))
+    if state > NN_TEMPORAL_STATE_SIZE:
+        raise ValueError('temporal layers of %d state values, the firmware supports %d' % (state, NN_TEMPORAL_STATE_SIZE))
+
+    version = NN_MODEL_VERSION if state > 0 else 1
+    data = struct.pack('<IHHHHI', NN_MODEL_MAGIC, version, len(layers), len(layers[0][0][0][0]), ENCODINGS[encoding], len(payload)) + payload
+    crc = zlib.crc32(data) & 0xFFFFFFFF
+    data += struct.pack('<I', crc)
+
+    if len(data) > NN_MODEL_MAXIMUM_SIZE:
+        raise ValueError('model of %d bytes, the firmware supports %d' % (len(data), NN_MODEL_MAXIMUM_SIZE))
+
+    with open(filename, 'wb') as file:
+        file.write(data)
+
+    return crc
+
+# ---------------------- MAIN ----------------------
+
+if __name__ == "__main__":
+    parser = argparse.ArgumentParser(description="Export NeuralNetworkFunction.m to the AudioMoth model file. Copy the file to the SD card next to NN_CONFIG.txt.")
+    parser.add_argument("--i", "--input", dest="input_file", default='NeuralNetworkFunction.m', help="Network function generated by b_trainNNmat.m")
+    parser.add_argument("--o", "--output", dest="output_file", default='NN_MODEL.bin', help="Output model file (NN_CONFIRM.bin for a confirmer with %d inputs)" % NN_CONFIRMER_NUMBER_OF_FEATURES)
+    args = parser.parse_args()
+
+    layers = read_network_function(args.input_file)
+    crc = write_model(args.output_file, layers)
+
+    print("Layers: " + ", ".join('%dx%d %s' % (len(w), len(w[0]), a) for w, _, a in layers))
+    print("Unrolled kernels (AudioMoth1110/inc/detector.h): #define NN_KERNEL_SHAPES {" + ", ".join('{%d, %d}' % (len(w[0]), len(w)) for w, _, _ in layers) + "}")
+    print("Model saved in: %s (CRC %08X)" % (args.output_file, crc))
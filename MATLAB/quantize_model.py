@@ -0,0 +1,174 @@
+# -*- coding: utf-8 -*-
+"""
+Quantize the network trained by b_trainNNmat.m (NeuralNetworkFunction.m) to the int8 model file
+read by the AudioMoth firmware, calibrating the scales with the features of test_files.py
+Modified: 2026
+"""
+
+import os
+import struct
+import argparse
+import numpy as np
+import librosa
+from scipy.signal import resample_poly
+
+from test_files import calculate_mfccs
+from export_model import read_network_function, write_model
+
+# ---------------------- INT8 ENCODING ----------------------
+# Must match AudioMoth1110/inc/detector.h and src/detector.c
+
+NN_ACTIVATION_TABLE_SIZE = 256
+NN_TANSIG_TABLE_STEP = 0.03125
+NN_SOFTMAX_TABLE_STEP = 0.03125
+Q7_ONE = 128.0
+INT8_MAXIMUM = 127
+
+TANSIG_TABLE = np.clip(np.round(np.tanh((np.arange(NN_ACTIVATION_TABLE_SIZE) - NN_ACTIVATION_TABLE_SIZE // 2) * NN_TANSIG_TABLE_STEP) * Q7_ONE), -128, 127)
+SOFTMAX_TABLE = np.round(65535 * np.exp(-np.arange(NN_ACTIVATION_TABLE_SIZE) * NN_SOFTMAX_TABLE_STEP))
+
+# ---------------------- FUNCIONES ----------------------
+
+def extract_features(input_dir, fs=32000, lwindow=1024, nbanks=41):
+    """
+    EXTRACT_FEATURES Computes the network inputs of every frame of the recordings in a folder, as process_files() in test_files.py.
+
+    Inputs:
+    - input_dir: Audio folder.
+
+    Outputs:
+    - X:         Matrix of 24 x frames with the 12 MFCCs and 12 deltas of each frame.
+    """
+    twindow = lwindow / fs
+    features = []
+    for filename in sorted(os.listdir(input_dir)):
+        if filename.lower().endswith('.wav') or filename.lower().endswith('.mp3'):
+            song, FS = librosa.load(os.path.join(input_dir, filename), sr=None, mono=False)
+            if song.ndim == 2:
+                song = np.mean(song, axis=0)
+            song = resample_poly(song.astype(np.float64), fs, FS)
+            mfccs, delta = calculate_mfccs(song, nbanks, twindow, fs)
+            features.append(np.concatenate([mfccs[1:13, :], delta[1:13, :]]))
+            print(f"Calibrating with: {filename} ({features[-1].shape[1]} frames)")
+
+    if not features:
+        raise ValueError('no recordings found in %s' % input_dir)
+
+    return np.hstack(features)
+
+def float_network(layers, X):
+    """
+    FLOAT_NETWORK Evaluates the float network, as NeuralNetworkFunction.m.
+
+    Outputs:
+    - outputs:   Output of each layer (the last one holds the class probabilities).
+    """
+    outputs = []
+    a = X
+    for weights, biases, activation in layers:
+        n = np.array(weights) @ a + np.array(biases)[:, None]
+        if activation == 'tansig':
+            a = 2 / (1 + np.exp(-2 * n)) - 1
+        elif activation == 'softmax':
+            e = np.exp(n - np.max(n, axis=0, keepdims=True))
+            a = e / np.sum(e, axis=0, keepdims=True)
+        else:
+            a = n
+        outputs.append(a)
+    return outputs
+
+def calibrate(layers, X):
+    """
+    CALIBRATE Chooses symmetric per-layer scales from the largest magnitudes seen in the calibration features.
+
+    Outputs:
+    - quantised: For each layer, a dictionary with the scales and the int8 weights and int32 biases.
+    """
+    outputs = float_network(layers, X)
+    quantised = []
+    input_scale = np.max(np.abs(X)) / INT8_MAXIMUM
+    for index, (weights, biases, activation) in enumerate(layers):
+        weights = np.array(weights)
+        weight_scale = np.max(np.abs(weights)) / INT8_MAXIMUM
+        if activation == 'tansig':
+            output_scale = 1 / Q7_ONE
+        elif activation == 'softmax':
+            output_scale = 1.0
+        else:
+            output_scale = max(np.max(np.abs(outputs[index])), 1e-6) / INT8_MAXIMUM
+        quantised.append({
+            'activation': activation,
+            'input_scale': np.float32(input_scale),
+            'weight_scale': np.float32(weight_scale),
+            'output_scale': np.float32(output_scale),
+            'weights': np.clip(np.round(weights / weight_scale), -INT8_MAXIMUM, INT8_MAXIMUM).astype(np.int8),
+            'biases': np.round(np.array(biases) / (np.float32(input_scale) * np.float32(weight_scale))).astype(np.int32)})
+        input_scale = output_scale
+    return quantised
+
+def requantise(accumulator, factor, minimum, maximum):
+    """
+    Requantise int32 accumulators with the Q31 multiplier and right shift the firmware derives from a float factor.
+    """
+    mantissa, exponent = np.frexp(np.float32(factor))
+    multiplier = int(np.float32(mantissa) * np.float32(2 ** 31))
+    shift = 31 - int(exponent)
+    value = (accumulator.astype(np.int64) * multiplier + (1 << (shift - 1))) >> shift
+    return np.clip(value, minimum, maximum)
+
+def quantised_network(quantised, X):
+    """
+    QUANTISED_NETWORK Evaluates the int8 network as quantisedNeuralNetwork() in the firmware.
+
+    Outputs:
+    - y:         Output of each class (rows) for each frame (columns).
+    """
+    value = np.clip(X.astype(np.float32) * np.float32(1 / quantised[0]['input_scale']), -128, 127)
+    a = np.trunc(value + np.where(value < 0, -0.5, 0.5)).astype(np.int64)
+    for index, layer in enumerate(quantised):
+        accumulator = layer['weights'].astype(np.int64) @ a + layer['biases'][:, None]
+        scale = np.float32(layer['input_scale'] * layer['weight_scale'])
+        if layer['activation'] == 'softmax':
+            logits = requantise(accumulator, scale / np.float32(NN_SOFTMAX_TABLE_STEP), -2 ** 30, 2 ** 30)
+            e = SOFTMAX_TABLE[np.minimum(np.max(logits, axis=0) - logits, NN_ACTIVATION_TABLE_SIZE - 1)]
+            return e / np.sum(e, axis=0)
+        if index == len(quantised) - 1 and layer['activation'] == 'purelin':
+            return accumulator * scale
+        if layer['activation'] == 'tansig':
+            half = NN_ACTIVATION_TABLE_SIZE // 2
+            a = TANSIG_TABLE[requantise(accumulator, scale / np.float32(NN_TANSIG_TABLE_STEP), -half, half - 1) + half].astype(np.int64)
+        else:
+            a = requantise(accumulator, scale / layer['output_scale'], -128, 127)
+    return a / Q7_ONE
+
+def pack_layer(layer):
+    """
+    Pack the int8 parameters of a layer: scales, int32 biases and int8 weights padded to a multiple of 4 bytes.
+    """
+    weights = layer['weights'].astype('<i1').tobytes()
+    return struct.pack('<3f', layer['input_scale'], layer['weight_scale'], layer['output_scale']) + layer['biases'].astype('<i4').tobytes() + weights + b'\0' * (-len(weights) % 4)
+
+# ---------------------- MAIN ----------------------
+
+if __name__ == "__main__":
+    parser = argparse.ArgumentParser(description="Quantize NeuralNetworkFunction.m to the int8 AudioMoth model file. Copy the file to the SD card next to NN_CONFIG.txt.")
+    parser.add_argument("--i", "--input", dest="input_dir", default='audios', help="Folder of calibration recordings")
+    parser.add_argument("--n", "--network", dest="network_file", default='NeuralNetworkFunction.m', help="Network function generated by b_trainNNmat.m")
+    parser.add_argument("--o", "--output", dest="output_file", default='NN_MODEL.bin', help="Output model file")
+    parser.add_argument("--min_conf", dest="threshold", type=float, default=0.5, help="Class 0 threshold used to count changed decisions (default=0.5)")
+    args = parser.parse_args()
+
+    layers = read_network_function(args.network_file)
+    X = extract_features(args.input_dir)
+    quantised = calibrate(layers, X)
+
+    y_float = float_network(layers, X)[-1]
+    y_int8 = quantised_network(quantised, X)
+    flips = np.sum((y_float[0] > args.threshold) != (y_int8[0] > args.threshold))
+
+    for index, layer in enumerate(quantised):
+        print("Layer %d: input scale %.4g, weight scale %.4g, %s" % (index + 1, layer['input_scale'], layer['weight_scale'], layer['activation']))
+    print("Frames: %d, maximum deviation from the float network: %.4f, changed decisions: %d (%.2f%%)" % (X.shape[1], np.max(np.abs(y_float - y_int8)), flips, 100.0 * flips / X.shape[1]))
+
+    crc = write_model(args.output_file, layers, 'int8', [pack_layer(layer) for layer in quantised])
+    print("Model saved in: %s (CRC %08X)" % (args.output_file, crc))